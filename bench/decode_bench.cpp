@@ -0,0 +1,166 @@
+#include "mdr_policy.hpp"
+#include "smbios_bench.hpp"
+#include "smbios_columns.hpp"
+#include "smbios_entry_point.hpp"
+#include "smbios_fields.hpp"
+#include "smbios_index.hpp"
+#include "smbios_table.hpp"
+
+#include <benchmark/benchmark.h>
+
+#include <cstdint>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <vector>
+
+namespace phosphor
+{
+namespace smbios
+{
+namespace bench
+{
+
+namespace
+{
+
+void BM_TypePtrWalk(benchmark::State& state, Sample* sample)
+{
+    for (auto _ : state)
+    {
+        size_t count = 0;
+        uint8_t* dataIn = sample->table();
+        while ((dataIn = getSMBIOSTypePtr(dataIn, memoryDeviceType,
+                                          sample->end())) != nullptr)
+        {
+            count++;
+            dataIn = smbiosNextPtr(dataIn, sample->end());
+        }
+        benchmark::DoNotOptimize(count);
+    }
+}
+
+void BM_NextPtrWalk(benchmark::State& state, Sample* sample)
+{
+    for (auto _ : state)
+    {
+        size_t count = 0;
+        for (uint8_t* dataIn = sample->table(); dataIn != nullptr;
+             dataIn = smbiosNextPtr(dataIn, sample->end()))
+        {
+            count++;
+        }
+        benchmark::DoNotOptimize(count);
+    }
+    state.SetBytesProcessed(state.iterations() * sample->entryPoint.tableSize);
+}
+
+/* Every string of every memory device, through the legacy lookup. */
+void BM_PositionToString(benchmark::State& state, Sample* sample)
+{
+    std::vector<uint8_t*> dimms;
+    for (Structure structure :
+         Table(sample->table(), sample->entryPoint.tableSize).structures())
+    {
+        if (structure.type() == memoryDeviceType)
+        {
+            dimms.push_back(structure.data());
+        }
+    }
+
+    for (auto _ : state)
+    {
+        for (uint8_t* dimm : dimms)
+        {
+            for (uint8_t position = 1; position <= 6; position++)
+            {
+                benchmark::DoNotOptimize(positionToString(
+                    position, *(dimm + 1), dimm, sample->end()));
+            }
+        }
+    }
+}
+
+/* What a sync does before the inventory objects publish anything: locate
+ * and verify the table, index it, decode every inventory type's fields
+ * copying their strings as the properties do, and build the memory
+ * columns.
+ */
+void BM_FullDecode(benchmark::State& state, Sample* sample)
+{
+    SmbiosIndex index;
+    MemoryColumns memory;
+
+    auto decodeAll = [&](uint8_t type, const auto& fields) {
+        size_t decoded = 0;
+        for (Structure structure : index.structures(type))
+        {
+            decodeFields(structure, fields, [&](const auto&, auto value) {
+                if constexpr (std::is_same_v<decltype(value),
+                                             std::string_view>)
+                {
+                    benchmark::DoNotOptimize(std::string(value));
+                }
+                decoded++;
+            });
+        }
+        return decoded;
+    };
+
+    for (auto _ : state)
+    {
+        std::optional<EntryPoint> entryPoint =
+            findEntryPoint(sample->image.data(), sample->image.size());
+        bool supported = isSupportedSMBIOSVersion(entryPoint->version);
+        std::optional<VerifiedTable> verified = VerifiedTable::verify(
+            sample->image.data() + entryPoint->tableOffset,
+            entryPoint->tableSize, MdrV2Policy::requiredLengths);
+        index.build(*verified);
+
+        size_t decoded = decodeAll(biosType, BiosFields::all) +
+                         decodeAll(systemType, SystemFields::all) +
+                         decodeAll(processorsType, ProcessorFields::all) +
+                         decodeAll(systemSlots, SystemSlotFields::all) +
+                         decodeAll(memoryDeviceType, MemoryDeviceFields::all);
+        decodeColumns(index, memory);
+        benchmark::DoNotOptimize(supported);
+        benchmark::DoNotOptimize(decoded);
+    }
+}
+
+void BM_CheckVersion(benchmark::State& state)
+{
+    const SMBIOSVersion versions[] = {{3, 2}, {3, 5}, {2, 8}, {3, 4}};
+    for (auto _ : state)
+    {
+        for (const SMBIOSVersion& version : versions)
+        {
+            benchmark::DoNotOptimize(isSupportedSMBIOSVersion(version));
+        }
+    }
+}
+
+[[maybe_unused]] const bool registered = [] {
+    for (Sample& sample : samples())
+    {
+        benchmark::RegisterBenchmark(("BM_TypePtrWalk/" + sample.name).c_str(),
+                                     BM_TypePtrWalk, &sample);
+        benchmark::RegisterBenchmark(("BM_NextPtrWalk/" + sample.name).c_str(),
+                                     BM_NextPtrWalk, &sample);
+        benchmark::RegisterBenchmark(
+            ("BM_PositionToString/" + sample.name).c_str(),
+            BM_PositionToString, &sample);
+        benchmark::RegisterBenchmark(("BM_FullDecode/" + sample.name).c_str(),
+                                     BM_FullDecode, &sample);
+    }
+    return true;
+}();
+
+} // namespace
+
+BENCHMARK(BM_CheckVersion);
+
+} // namespace bench
+} // namespace smbios
+} // namespace phosphor
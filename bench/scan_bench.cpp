@@ -0,0 +1,83 @@
+#include "smbios_bench.hpp"
+#include "smbios_scan.hpp"
+
+#include <benchmark/benchmark.h>
+
+#include <cstdint>
+#include <vector>
+
+namespace phosphor
+{
+namespace smbios
+{
+namespace bench
+{
+
+namespace
+{
+
+/* The daemons' MDR region size, which bounded the old scan. */
+constexpr uint16_t regionSize = 32 * 1024;
+
+/* smbiosNextPtr as it was before the vectorized scanner. */
+uint8_t* legacyNextPtr(uint8_t* smbiosDataIn, const uint8_t*)
+{
+    uint8_t* smbiosData = smbiosDataIn + *(smbiosDataIn + 1);
+    int len = 0;
+    while ((*smbiosData | *(smbiosData + 1)) != 0)
+    {
+        smbiosData++;
+        len++;
+        if (len >= regionSize) // To avoid endless loop
+        {
+            return nullptr;
+        }
+    }
+    return smbiosData + separateLen;
+}
+
+/* Walk the sample's table the way the daemon did before the index. The
+ * table is copied into a zero-filled region, as the old scan could read
+ * up to regionSize bytes past a structure.
+ */
+template <uint8_t* (*next)(uint8_t*, const uint8_t*)>
+void walkTable(benchmark::State& state, Sample* sample)
+{
+    const uint8_t* begin = sample->table();
+    std::vector<uint8_t> table(begin, sample->end());
+    table.resize(table.size() + regionSize, 0);
+    const uint8_t* end = table.data() + table.size();
+
+    size_t structures = 0;
+    for (auto _ : state)
+    {
+        uint8_t* dataIn = table.data();
+        while (dataIn != nullptr && (*dataIn | *(dataIn + 1)) != 0)
+        {
+            structures++;
+            dataIn = next(dataIn, end);
+        }
+        benchmark::DoNotOptimize(dataIn);
+    }
+    state.SetItemsProcessed(structures);
+    state.SetBytesProcessed(state.iterations() * sample->entryPoint.tableSize);
+}
+
+[[maybe_unused]] const bool registered = [] {
+    for (Sample& sample : samples())
+    {
+        benchmark::RegisterBenchmark(
+            ("BM_LegacyNextPtr/" + sample.name).c_str(),
+            walkTable<legacyNextPtr>, &sample);
+        benchmark::RegisterBenchmark(
+            ("BM_SmbiosNextPtr/" + sample.name).c_str(),
+            walkTable<smbiosNextPtr>, &sample);
+    }
+    return true;
+}();
+
+} // namespace
+
+} // namespace bench
+} // namespace smbios
+} // namespace phosphor
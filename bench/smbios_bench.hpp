@@ -0,0 +1,258 @@
+#pragma once
+
+#include "smbios_entry_point.hpp"
+#include "smbios_parse.hpp"
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <initializer_list>
+#include <iterator>
+#include <optional>
+#include <string>
+#include <vector>
+
+namespace phosphor
+{
+namespace smbios
+{
+namespace bench
+{
+
+/* Inventory shape of a generated table. */
+struct TableShape
+{
+    unsigned sockets;
+    unsigned dimms;
+    unsigned slots;
+};
+
+/* Builds structure tables laid out the way server firmware emits them:
+ * platform structures first, then per-socket processor and cache entries,
+ * slots, the memory array and one memory device per DIMM slot.
+ */
+class TableBuilder
+{
+  public:
+    explicit TableBuilder(const TableShape& shape)
+    {
+        addPlatform();
+        for (unsigned socket = 0; socket < shape.sockets; socket++)
+        {
+            addProcessor(socket);
+        }
+        for (unsigned slot = 0; slot < shape.slots; slot++)
+        {
+            addSlot(slot);
+        }
+        addStructure(physicalMemoryArrayType, 23,
+                     {3, 3, 6, 0, 0, 0, 0x80, 0xfe, 0xff, 0xfe, 0xff,
+                      static_cast<uint8_t>(shape.dimms)},
+                     {});
+        for (unsigned dimm = 0; dimm < shape.dimms; dimm++)
+        {
+            addMemoryDevice(dimm, shape.dimms / (shape.sockets ? shape.sockets
+                                                               : 1));
+        }
+        addStructure(127, 4, {}, {});
+        table.insert(table.end(), 16, 0);
+    }
+
+    const std::vector<uint8_t>& data() const
+    {
+        return table;
+    }
+
+  private:
+    void addStructure(uint8_t type, uint8_t length,
+                      std::initializer_list<uint8_t> formatted,
+                      const std::vector<std::string>& strings)
+    {
+        size_t start = table.size();
+        table.push_back(type);
+        table.push_back(length);
+        table.push_back(handle & 0xff);
+        table.push_back(handle >> 8);
+        handle++;
+        table.insert(table.end(), formatted);
+        table.resize(start + length, 0);
+        for (const std::string& str : strings)
+        {
+            table.insert(table.end(), str.begin(), str.end());
+            table.push_back('\0');
+        }
+        if (strings.empty())
+        {
+            table.push_back('\0');
+        }
+        table.push_back('\0');
+    }
+
+    void addPlatform()
+    {
+        addStructure(biosType, 26, {1, 2, 0, 0xf0, 3, 0xff},
+                     {"American Megatrends International, LLC.",
+                      "SE5C620.86B.02.01.0013.121520200651", "12/15/2020"});
+        addStructure(systemType, 27, {1, 2, 3, 4},
+                     {"Intel Corporation", "S2600WFT", "....................",
+                      "BQWF92300123", "Family", "SKU Number"});
+        addStructure(baseboardType, 15, {1, 2, 3, 4, 5},
+                     {"Intel Corporation", "S2600WFT", "H48104-872",
+                      "BQWF92300123", "Base Board Asset Tag"});
+        addStructure(chassisType, 22, {1, 0x17, 2, 3, 4},
+                     {"Intel Corporation", "..................",
+                      "..................", "...................."});
+        addStructure(oemStringsType, 5, {3},
+                     {"Intel SPS 04.01.04.339", "ME 4.1.4.339",
+                      "BIOS Guard 2.0"});
+    }
+
+    void addProcessor(unsigned socket)
+    {
+        for (unsigned level = 1; level <= 3; level++)
+        {
+            addStructure(cacheType, 27, {1}, {"L" + std::to_string(level)});
+        }
+        addStructure(
+            processorsType, 48,
+            {1, 3, 0xb3, 2, 0x54, 0x06, 0x05, 0x00, 0xff, 0xfb, 0xeb, 0xbf, 3,
+             0x8b, 0x64, 0x00, 0x68, 0x10, 0x5c, 0x0b, 0x41, 1, 0, 0, 0, 0, 0,
+             0, 4, 5, 6, 28, 28, 56, 0xfc, 0x00},
+            {"CPU" + std::to_string(socket), "Intel(R) Corporation",
+             "Intel(R) Xeon(R) Platinum 8280 CPU @ 2.70GHz",
+             "Serial" + std::to_string(socket), "Asset Tag",
+             "Part Number"});
+    }
+
+    void addSlot(unsigned slot)
+    {
+        addStructure(systemSlots, 17,
+                     {1, static_cast<uint8_t>(slot % 2 ? 0xb6 : 0xa5), 0x0d, 3,
+                      4, static_cast<uint8_t>(slot), 0, 0x0c, 0x01},
+                     {"PCIE_SLOT" + std::to_string(slot + 1)});
+    }
+
+    void addMemoryDevice(unsigned dimm, unsigned perSocket)
+    {
+        unsigned socket = perSocket ? dimm / perSocket : 0;
+        std::string channel(1, static_cast<char>('A' + (dimm % perSocket) / 2));
+        addStructure(memoryDeviceType, 84,
+                     {0x00, 0x10, 0xfe, 0xff, 0x48, 0x00, 0x40, 0x00, 0x00,
+                      0x80, 0x09, 0x00, 1, 2, 0x1a, 0x80, 0x20, 0xb0, 0x0b, 3,
+                      4, 5, 6, 0x02},
+                     {"CPU" + std::to_string(socket) + "_DIMM_" + channel +
+                          std::to_string(dimm % 2 + 1),
+                      "NODE " + std::to_string(socket), "Samsung",
+                      "0x3A2B" + std::to_string(1000 + dimm), "Asset Tag",
+                      "M393A4K40DB3-CWE    "});
+    }
+
+    uint16_t handle = 0;
+
+    std::vector<uint8_t> table;
+};
+
+/* Wrap a structure table the way dmidecode --dump-bin writes it: a 3.0
+ * entry point at offset 0 whose table address is the file offset 0x20.
+ */
+inline std::vector<uint8_t> dumpImage(const std::vector<uint8_t>& table)
+{
+    constexpr size_t tableOffset = 0x20;
+
+    EntryPointStructure30 ep{};
+    std::memcpy(ep.anchorString, "_SM3_", sizeof(ep.anchorString));
+    ep.epLength = sizeof(ep);
+    ep.smbiosVersion = {3, 3};
+    ep.epRevision = 1;
+    ep.structTableMaxSize = static_cast<uint32_t>(table.size());
+    ep.structTableAddr = tableOffset;
+    auto bytes = reinterpret_cast<uint8_t*>(&ep);
+    uint8_t sum = 0;
+    for (size_t index = 0; index < sizeof(ep); index++)
+    {
+        sum += bytes[index];
+    }
+    ep.epChecksum = static_cast<uint8_t>(-sum);
+
+    std::vector<uint8_t> image(tableOffset, 0);
+    std::memcpy(image.data(), &ep, sizeof(ep));
+    image.insert(image.end(), table.begin(), table.end());
+    return image;
+}
+
+/* One table dump: the image as stored and where its table lies. */
+struct Sample
+{
+    std::string name;
+    std::vector<uint8_t> image;
+    EntryPoint entryPoint;
+
+    uint8_t* table()
+    {
+        return image.data() + entryPoint.tableOffset;
+    }
+
+    const uint8_t* end()
+    {
+        return table() + entryPoint.tableSize;
+    }
+};
+
+inline std::optional<Sample> makeSample(std::string name,
+                                        std::vector<uint8_t> image)
+{
+    std::optional<EntryPoint> entryPoint =
+        findEntryPoint(image.data(), image.size());
+    if (!entryPoint)
+    {
+        return std::nullopt;
+    }
+    return Sample{std::move(name), std::move(image), *entryPoint};
+}
+
+/* The checked-in generated tables, then ones larger than any real system.
+ * Loaded once and shared by every benchmark file.
+ */
+inline std::vector<Sample>& samples()
+{
+    static std::vector<Sample> loaded = [] {
+        std::vector<Sample> found;
+        std::vector<std::filesystem::path> paths;
+        for (const auto& entry :
+             std::filesystem::directory_iterator(SMBIOS_BENCH_TABLES))
+        {
+            if (entry.path().extension() == ".bin")
+            {
+                paths.push_back(entry.path());
+            }
+        }
+        std::sort(paths.begin(), paths.end());
+        for (const std::filesystem::path& path : paths)
+        {
+            std::ifstream file(path, std::ios::binary);
+            std::vector<uint8_t> image(std::istreambuf_iterator<char>(file),
+                                       {});
+            if (auto sample = makeSample(path.stem(), std::move(image)))
+            {
+                found.push_back(std::move(*sample));
+            }
+        }
+
+        const TableShape oversized[] = {{8, 1024, 64}, {16, 4096, 128}};
+        for (const TableShape& shape : oversized)
+        {
+            std::string name = "generated-" + std::to_string(shape.sockets) +
+                               "s-" + std::to_string(shape.dimms) + "dimm";
+            found.push_back(
+                *makeSample(name, dumpImage(TableBuilder(shape).data())));
+        }
+        return found;
+    }();
+    return loaded;
+}
+
+} // namespace bench
+} // namespace smbios
+} // namespace phosphor
@@ -0,0 +1,136 @@
+#include "smbios_bench.hpp"
+#include "smbios_columns.hpp"
+#include "smbios_index.hpp"
+#include "smbios_table.hpp"
+
+#include <benchmark/benchmark.h>
+
+#include <cstdint>
+#include <cstring>
+#include <optional>
+#include <ranges>
+#include <vector>
+
+namespace phosphor
+{
+namespace smbios
+{
+namespace bench
+{
+
+namespace
+{
+
+const TableShape shapes[] = {{1, 4, 2}, {2, 16, 6}, {2, 32, 8}, {8, 96, 16}};
+
+/* Count memory devices the way the call sites did with raw pointers. */
+void BM_RawPointerCount(benchmark::State& state)
+{
+    std::vector<uint8_t> table = TableBuilder(shapes[state.range(0)]).data();
+    const uint8_t* end = table.data() + table.size();
+
+    for (auto _ : state)
+    {
+        size_t count = 0;
+        uint8_t* dataIn = table.data();
+        while ((dataIn = getSMBIOSTypePtr(dataIn, memoryDeviceType, end)) !=
+               nullptr)
+        {
+            count++;
+            dataIn = smbiosNextPtr(dataIn, end);
+        }
+        benchmark::DoNotOptimize(count);
+    }
+}
+
+void BM_RangeFilterCount(benchmark::State& state)
+{
+    std::vector<uint8_t> table = TableBuilder(shapes[state.range(0)]).data();
+    Table smbiosTable(table.data(), table.size());
+
+    for (auto _ : state)
+    {
+        auto dimms = smbiosTable.structures() |
+                     std::views::filter(byType(memoryDeviceType));
+        benchmark::DoNotOptimize(std::ranges::distance(dimms));
+    }
+}
+
+/* Verify a table and index it, as each sync does. */
+void BM_IndexBuild(benchmark::State& state)
+{
+    std::vector<uint8_t> table = TableBuilder(shapes[state.range(0)]).data();
+    SmbiosIndex index;
+
+    for (auto _ : state)
+    {
+        std::optional<VerifiedTable> verified =
+            VerifiedTable::verify(table.data(), table.size(), {});
+        index.build(*verified);
+        benchmark::DoNotOptimize(index.count(memoryDeviceType));
+    }
+}
+
+SmbiosIndex indexFor(std::vector<uint8_t>& table)
+{
+    SmbiosIndex index;
+    index.build(*VerifiedTable::verify(table.data(), table.size(), {}));
+    return index;
+}
+
+/* Total installed memory by walking the type-17 records on every query. */
+void BM_MemoryRecordTotal(benchmark::State& state)
+{
+    std::vector<uint8_t> table = TableBuilder(shapes[state.range(0)]).data();
+    SmbiosIndex index = indexFor(table);
+
+    for (auto _ : state)
+    {
+        uint64_t total = 0;
+        for (Structure structure : index.structures(memoryDeviceType))
+        {
+            uint16_t size;
+            std::memcpy(&size, structure.data() + 0x0c, sizeof(size));
+            total += uint64_t(size) * 1024;
+        }
+        benchmark::DoNotOptimize(total);
+    }
+}
+
+void BM_MemoryColumnsDecode(benchmark::State& state)
+{
+    std::vector<uint8_t> table = TableBuilder(shapes[state.range(0)]).data();
+    SmbiosIndex index = indexFor(table);
+    MemoryColumns memory;
+
+    for (auto _ : state)
+    {
+        decodeColumns(index, memory);
+        benchmark::DoNotOptimize(memory.size());
+    }
+}
+
+void BM_MemoryColumnsTotal(benchmark::State& state)
+{
+    std::vector<uint8_t> table = TableBuilder(shapes[state.range(0)]).data();
+    MemoryColumns memory;
+    decodeColumns(indexFor(table), memory);
+
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(memory.totalSizeKiB());
+    }
+}
+
+} // namespace
+
+BENCHMARK(BM_RawPointerCount)->DenseRange(0, std::size(shapes) - 1);
+BENCHMARK(BM_RangeFilterCount)->DenseRange(0, std::size(shapes) - 1);
+BENCHMARK(BM_IndexBuild)->DenseRange(0, std::size(shapes) - 1);
+BENCHMARK(BM_MemoryRecordTotal)->DenseRange(0, std::size(shapes) - 1);
+BENCHMARK(BM_MemoryColumnsDecode)->DenseRange(0, std::size(shapes) - 1);
+BENCHMARK(BM_MemoryColumnsTotal)->DenseRange(0, std::size(shapes) - 1);
+
+} // namespace bench
+} // namespace smbios
+} // namespace phosphor
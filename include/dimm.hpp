@@ -15,7 +15,9 @@
 */
 
 #pragma once
+#include "mdr_policy.hpp"
 #include "smbios.hpp"
+#include "smbios_index.hpp"
 #include <xyz/openbmc_project/Inventory/Decorator/Asset/server.hpp>
 #include <xyz/openbmc_project/Inventory/Item/Dimm/server.hpp>
 #include <xyz/openbmc_project/Association/Definitions/server.hpp>
@@ -30,171 +32,25 @@ namespace phosphor
 namespace smbios
 {
 
-#ifdef SMBIOS_MDRV1
-
-using DeviceType =
-    sdbusplus::xyz::openbmc_project::Inventory::Item::server::Dimm::DeviceType;
-
-class Dimm :
-    sdbusplus::server::object_t<
-        sdbusplus::xyz::openbmc_project::Inventory::Item::server::Dimm>,
-    sdbusplus::server::object_t<
-        sdbusplus::xyz::openbmc_project::Inventory::Decorator::server::Asset>,
-    sdbusplus::server::object_t<sdbusplus::xyz::openbmc_project::Inventory::
-                                    Decorator::server::LocationCode>,
-    sdbusplus::server::object_t<
-        sdbusplus::xyz::openbmc_project::Inventory::Connector::server::Slot>,
-    sdbusplus::server::object_t<
-        sdbusplus::xyz::openbmc_project::Inventory::server::Item>,
-    sdbusplus::server::object_t<
-        sdbusplus::xyz::openbmc_project::Association::server::Definitions>,
-    sdbusplus::server::object_t<sdbusplus::xyz::openbmc_project::State::
-                                    Decorator::server::OperationalStatus>
-
-{
-  public:
-    Dimm() = delete;
-    ~Dimm() = default;
-    Dimm(const Dimm &) = delete;
-    Dimm &operator=(const Dimm &) = delete;
-    Dimm(Dimm &&) = default;
-    Dimm &operator=(Dimm &&) = default;
-
-    Dimm(sdbusplus::bus_t& bus, const std::string& objPath,
-         const uint8_t& dimmId, struct ManagedDataRegion *region) :
-
-        sdbusplus::server::object_t<
-            sdbusplus::xyz::openbmc_project::Inventory::Item::server::Dimm>(
-            bus, objPath.c_str()),
-        sdbusplus::server::object_t<sdbusplus::xyz::openbmc_project::Inventory::
-                                        Decorator::server::Asset>(
-            bus, objPath.c_str()),
-        sdbusplus::server::object_t<sdbusplus::xyz::openbmc_project::Inventory::
-                                        Decorator::server::LocationCode>(
-            bus, objPath.c_str()),
-        sdbusplus::server::object_t<sdbusplus::xyz::openbmc_project::Inventory::
-                                        Connector::server::Slot>(
-            bus, objPath.c_str()),
-        sdbusplus::server::object_t<
-            sdbusplus::xyz::openbmc_project::Inventory::server::Item>(
-            bus, objPath.c_str()),
-        sdbusplus::server::object_t<
-            sdbusplus::xyz::openbmc_project::Association::server::Definitions>(
-            bus, objPath.c_str()),
-        sdbusplus::server::object_t<sdbusplus::xyz::openbmc_project::State::
-                                        Decorator::server::OperationalStatus>(
-            bus, objPath.c_str()),
-        dimmNum(dimmId), regionS(region)
-    {
-        memoryInfoUpdate();
-    }
-
-    void memoryInfoUpdate(void);
-
-    uint16_t memoryDataWidth(uint16_t value) override;
-    uint32_t memorySizeInKB(uint32_t value) override;
-    std::string memoryDeviceLocator(std::string value) override;
-    DeviceType memoryType(DeviceType value) override;
-    std::string memoryTypeDetail(std::string value) override;
-    uint16_t maxMemorySpeedInMhz(uint16_t value) override;
-    std::string manufacturer(std::string value) override;
-    bool present(bool value) override;
-    std::string serialNumber(std::string value) override;
-    std::string partNumber(std::string value) override;
-    std::string locationCode(std::string value) override;
-    uint8_t memoryAttributes(uint8_t value) override;
-    uint16_t memoryConfiguredSpeedInMhz(uint16_t value) override;
-    bool functional(bool value) override;
-
-  private:
-    uint8_t dimmNum;
-
-    struct ManagedDataRegion *regionS;
-
-    void dimmSize(uint16_t size);
-    void dimmSizeExt(uint32_t size);
-    void dimmDeviceLocator(uint8_t positionNum, uint8_t structLen,
-                           uint8_t *dataIn);
-    void dimmType(uint8_t type);
-    void dimmTypeDetail(uint16_t detail);
-    void dimmManufacturer(uint8_t positionNum, uint8_t structLen,
-                          uint8_t *dataIn);
-    void dimmSerialNum(uint8_t positionNum, uint8_t structLen, uint8_t *dataIn);
-    void dimmPartNum(uint8_t positionNum, uint8_t structLen, uint8_t *dataIn);
-
-    struct MemoryInfo
-    {
-        uint8_t type;
-        uint8_t length;
-        uint16_t handle;
-        uint16_t phyArrayHandle;
-        uint16_t errInfoHandle;
-        uint16_t totalWidth;
-        uint16_t dataWidth;
-        uint16_t size;
-        uint8_t formFactor;
-        uint8_t deviceSet;
-        uint8_t deviceLocator;
-        uint8_t bankLocator;
-        uint8_t memoryType;
-        uint16_t typeDetail;
-        uint16_t speed;
-        uint8_t manufacturer;
-        uint8_t serialNum;
-        uint8_t assetTag;
-        uint8_t partNum;
-        uint8_t attributes;
-        uint32_t extendedSize;
-        uint16_t confClockSpeed;
-    } __attribute__((packed));
-};
-
-const std::map<uint8_t, DeviceType> dimmTypeTable = {
-    {0x1, DeviceType::Other},         {0x2, DeviceType::Unknown},
-    {0x3, DeviceType::DRAM},          {0x4, DeviceType::EDRAM},
-    {0x5, DeviceType::VRAM},          {0x6, DeviceType::SRAM},
-    {0x7, DeviceType::RAM},           {0x8, DeviceType::ROM},
-    {0x9, DeviceType::FLASH},         {0xa, DeviceType::EEPROM},
-    {0xb, DeviceType::FEPROM},        {0xc, DeviceType::EPROM},
-    {0xd, DeviceType::CDRAM},         {0xe, DeviceType::ThreeDRAM},
-    {0xf, DeviceType::SDRAM},         {0x10, DeviceType::DDR_SGRAM},
-    {0x11, DeviceType::RDRAM},        {0x12, DeviceType::DDR},
-    {0x13, DeviceType::DDR2},         {0x14, DeviceType::DDR2_SDRAM_FB_DIMM},
-    {0x18, DeviceType::DDR3},         {0x19, DeviceType::FBD2},
-    {0x1a, DeviceType::DDR4},         {0x1b, DeviceType::LPDDR_SDRAM},
-    {0x1c, DeviceType::LPDDR2_SDRAM}, {0x1d, DeviceType::LPDDR3_SDRAM},
-    {0x1e, DeviceType::LPDDR4_SDRAM}, {0x1f, DeviceType::Logical},
-    {0x20, DeviceType::HBM},          {0x21, DeviceType::HBM2}};
-
-const std::string detailTable[16]{
-    "Reserved",      "Other",         "Unknown",     "Fast-paged",
-    "Static column", "Pseudo-static", "RAMBUS",      "Synchronous",
-    "CMOS",          "EDO",           "Window DRAM", "Cache DRAM",
-    "Non-volatile",  "Registered",    "Unbuffered",  "LRDIMM"};
-
-#elifdef SMBIOS_MDRV2
-
 using DeviceType =
     sdbusplus::xyz::openbmc_project::Inventory::Item::server::Dimm::DeviceType;
 
 using EccType =
     sdbusplus::xyz::openbmc_project::Inventory::Item::server::Dimm::Ecc;
 
-class Dimm :
-    sdbusplus::server::object_t<
-        sdbusplus::xyz::openbmc_project::Inventory::Item::server::Dimm>,
-    sdbusplus::server::object_t<
-        sdbusplus::xyz::openbmc_project::Inventory::Decorator::server::Asset>,
-    sdbusplus::server::object_t<sdbusplus::xyz::openbmc_project::Inventory::
-                                    Decorator::server::LocationCode>,
-    sdbusplus::server::object_t<
-        sdbusplus::xyz::openbmc_project::Inventory::Connector::server::Slot>,
-    sdbusplus::server::object_t<
-        sdbusplus::xyz::openbmc_project::Inventory::server::Item>,
-    sdbusplus::server::object_t<
-        sdbusplus::xyz::openbmc_project::Association::server::Definitions>,
-    sdbusplus::server::object_t<sdbusplus::xyz::openbmc_project::State::
-                                    Decorator::server::OperationalStatus>
+using DimmObject = sdbusplus::server::object_t<
+    sdbusplus::xyz::openbmc_project::Inventory::Item::server::Dimm,
+    sdbusplus::xyz::openbmc_project::Inventory::Decorator::server::Asset,
+    sdbusplus::xyz::openbmc_project::Inventory::Decorator::server::
+        LocationCode,
+    sdbusplus::xyz::openbmc_project::Inventory::Connector::server::Slot,
+    sdbusplus::xyz::openbmc_project::Inventory::server::Item,
+    sdbusplus::xyz::openbmc_project::Association::server::Definitions,
+    sdbusplus::xyz::openbmc_project::State::Decorator::server::
+        OperationalStatus>;
+
+template <typename Policy>
+class Dimm : public DimmObject
 {
   public:
     Dimm() = delete;
@@ -205,38 +61,25 @@ class Dimm :
     Dimm& operator=(Dimm&&) = default;
 
     Dimm(sdbusplus::bus_t& bus, const std::string& objPath,
-         const uint8_t& dimmId, uint8_t* smbiosTableStorage,
-         const std::string& motherboard) :
-
-        sdbusplus::server::object_t<
-            sdbusplus::xyz::openbmc_project::Inventory::Item::server::Dimm>(
-            bus, objPath.c_str()),
-        sdbusplus::server::object_t<sdbusplus::xyz::openbmc_project::Inventory::
-                                        Decorator::server::Asset>(
-            bus, objPath.c_str()),
-        sdbusplus::server::object_t<sdbusplus::xyz::openbmc_project::Inventory::
-                                        Decorator::server::LocationCode>(
-            bus, objPath.c_str()),
-        sdbusplus::server::object_t<sdbusplus::xyz::openbmc_project::Inventory::
-                                        Connector::server::Slot>(
-            bus, objPath.c_str()),
-        sdbusplus::server::object_t<
-            sdbusplus::xyz::openbmc_project::Inventory::server::Item>(
-            bus, objPath.c_str()),
-        sdbusplus::server::object_t<
-            sdbusplus::xyz::openbmc_project::Association::server::Definitions>(
-            bus, objPath.c_str()),
-        sdbusplus::server::object_t<sdbusplus::xyz::openbmc_project::State::
-                                        Decorator::server::OperationalStatus>(
-            bus, objPath.c_str()),
-        dimmNum(dimmId), storage(smbiosTableStorage),
-        motherboardPath(motherboard)
+         const uint8_t& dimmId, const SmbiosIndex& index,
+         const std::string& motherboard = {}) :
+        DimmObject(bus, objPath.c_str(), DimmObject::action::defer_emit),
+        dimmNum(dimmId), smbiosIndex(index), motherboardPath(motherboard)
     {
         memoryInfoUpdate();
+        skipSignal = false;
+        emit_object_added();
     }
 
     void memoryInfoUpdate(void);
 
+    /** @brief Re-read the memory device after a sync, keeping the object. */
+    void refresh(const std::string& motherboard)
+    {
+        motherboardPath = motherboard;
+        memoryInfoUpdate();
+    }
+
     uint16_t memoryDataWidth(uint16_t value) override;
     size_t memorySizeInKB(size_t value) override;
     std::string memoryDeviceLocator(std::string value) override;
@@ -256,24 +99,25 @@ class Dimm :
   private:
     uint8_t dimmNum;
 
-    uint8_t* storage;
+    const SmbiosIndex& smbiosIndex;
 
     std::string motherboardPath;
 
+    /* Set until the populated object is announced with InterfacesAdded. */
+    bool skipSignal = true;
+
     void dimmSize(const uint16_t size);
     void dimmSizeExt(const size_t size);
-    void dimmDeviceLocator(const uint8_t bankLocatorPositionNum,
-                           const uint8_t deviceLocatorPositionNum,
-                           const uint8_t structLen, uint8_t* dataIn);
+    void dimmDeviceLocator(std::string_view bankLocator,
+                           std::string_view deviceLocator);
     void dimmType(const uint8_t type);
     void dimmTypeDetail(const uint16_t detail);
-    void dimmManufacturer(const uint8_t positionNum, const uint8_t structLen,
-                          uint8_t* dataIn);
-    void dimmSerialNum(const uint8_t positionNum, const uint8_t structLen,
-                       uint8_t* dataIn);
-    void dimmPartNum(const uint8_t positionNum, const uint8_t structLen,
-                     uint8_t* dataIn);
+    void dimmManufacturer(std::string_view value);
+    void dimmSerialNum(std::string_view value);
+    void dimmPartNum(std::string_view value);
     void updateEccType(uint16_t exPhyArrayHandle);
+    /* Reset every property memoryInfoUpdate() sets to its default. */
+    void clearInfo(void);
 };
 
 struct MemoryInfo
@@ -298,7 +142,7 @@ struct MemoryInfo
     uint8_t assetTag;
     uint8_t partNum;
     uint8_t attributes;
-    size_t extendedSize;
+    uint32_t extendedSize;
     uint16_t confClockSpeed;
     uint16_t minimumVoltage;
     uint16_t maximumVoltage;
@@ -315,6 +159,8 @@ struct MemoryInfo
     uint64_t cacheSize;
     uint64_t logicalSize;
 } __attribute__((packed));
+static_assert(sizeof(MemoryInfo) == 0x54,
+              "Size of MemoryInfo struct is incorrect.");
 
 /**
  * @brief Struct to represent SMBIOS 3.2 type-16 (Physical Memory Array) data.
@@ -373,7 +219,9 @@ const std::map<uint8_t, EccType> dimmEccTypeMap = {
     {0x5, EccType::SingleBitECC}, {0x6, EccType::MultiBitECC},
     {0x7, EccType::NoECC}};
 
-#endif
+extern template class Dimm<MdrV1Policy>;
+extern template class Dimm<MdrV2Policy>;
+
 } // namespace smbios
 
 } // namespace phosphor
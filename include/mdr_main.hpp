@@ -0,0 +1,17 @@
+#pragma once
+
+namespace phosphor
+{
+
+namespace smbios
+{
+
+/** @brief Serve the MDR V1 region interface until the event loop fails. */
+int runMdrV1(void);
+
+/** @brief Serve the MDR V2 interface and its inventory objects. */
+int runMdrV2(void);
+
+} // namespace smbios
+
+} // namespace phosphor
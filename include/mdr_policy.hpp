@@ -0,0 +1,91 @@
+#pragma once
+
+#include "smbios_fields.hpp"
+#include "smbios_table.hpp"
+
+namespace phosphor
+{
+
+namespace smbios
+{
+
+/**
+ * @brief What the inventory objects publish for each MDR protocol.
+ *
+ * Cpu and Dimm take one of these as a template parameter. Both protocols
+ * share the parser and the objects, and every difference is resolved at
+ * compile time, so one build serves either protocol without branching on
+ * it at run time.
+ *
+ * requiredLengths is the shortest structure of each type the protocol's
+ * readers accept, long enough for every field they read. Types the
+ * protocol does not publish are not checked.
+ */
+struct MdrV1Policy
+{
+    /* Resolve Processor Family 2 and publish EffectiveFamily. */
+    static constexpr bool processorFamily2 = false;
+    /* Publish the processor serial and part numbers. */
+    static constexpr bool processorAssetNumbers = false;
+    /* Publish the processor characteristics as capabilities. */
+    static constexpr bool processorCapabilities = false;
+    /* Prefix the DIMM location with its bank locator. */
+    static constexpr bool dimmBankLocator = false;
+    /* Publish the ECC type of the DIMM's memory array. */
+    static constexpr bool dimmEcc = false;
+
+    /* V1 only publishes processors and memory devices. The processor
+     * counts are the last 2.5 fields it reads; Core Count 2 and Thread
+     * Count 2 are only read from structures long enough to hold them.
+     */
+    static constexpr LengthRequirements requiredLengths = [] {
+        LengthRequirements lengths{};
+        lengths[processorsType] = lengthCovering(
+            ProcessorFields::socket, ProcessorFields::family,
+            ProcessorFields::manufacturer, ProcessorFields::id,
+            ProcessorFields::version, ProcessorFields::maxSpeed,
+            ProcessorFields::status, ProcessorFields::coreCount,
+            ProcessorFields::threadCount);
+        lengths[memoryDeviceType] = lengthCovering(
+            MemoryDeviceFields::dataWidth, MemoryDeviceFields::size,
+            MemoryDeviceFields::deviceLocator, MemoryDeviceFields::bankLocator,
+            MemoryDeviceFields::memoryType, MemoryDeviceFields::typeDetail,
+            MemoryDeviceFields::speed, MemoryDeviceFields::manufacturer,
+            MemoryDeviceFields::serialNumber, MemoryDeviceFields::partNumber,
+            MemoryDeviceFields::attributes, MemoryDeviceFields::extendedSize,
+            MemoryDeviceFields::configuredSpeed);
+        return lengths;
+    }();
+};
+
+struct MdrV2Policy
+{
+    static constexpr bool processorFamily2 = true;
+    static constexpr bool processorAssetNumbers = true;
+    static constexpr bool processorCapabilities = true;
+    static constexpr bool dimmBankLocator = true;
+    static constexpr bool dimmEcc = true;
+
+    /* Also covers the types GetRecordType reads. Every supported table
+     * version is 3.2 or newer.
+     */
+    static constexpr LengthRequirements requiredLengths = [] {
+        LengthRequirements lengths{};
+        lengths[biosType] = lengthThrough(BiosFields::all, specVersion(2, 0));
+        lengths[systemType] =
+            lengthThrough(SystemFields::all, specVersion(2, 1));
+        lengths[processorsType] =
+            lengthThrough(ProcessorFields::all, specVersion(3, 0));
+        lengths[systemSlots] =
+            lengthThrough(SystemSlotFields::all, specVersion(2, 1));
+        lengths[physicalMemoryArrayType] =
+            lengthThrough(PhysicalMemoryArrayFields::all, specVersion(2, 7));
+        lengths[memoryDeviceType] =
+            lengthThrough(MemoryDeviceFields::all, specVersion(3, 2));
+        return lengths;
+    }();
+};
+
+} // namespace smbios
+
+} // namespace phosphor
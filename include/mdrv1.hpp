@@ -17,6 +17,9 @@
 #pragma once
 
 #include "smbios.hpp"
+#include "smbios_fields.hpp"
+#include "smbios_index.hpp"
+#include "smbios_table.hpp"
 #include "timer.hpp"
 #include "xyz/openbmc_project/Smbios/MDR_V1/server.hpp"
 #include <phosphor-logging/elog-errors.hpp>
@@ -58,9 +61,9 @@ class MDR_V1 : sdbusplus::xyz::openbmc_project::Smbios::server::MDR_V1
         }
 
         std::copy(region, region + maxRegion, regionS);
-        if (access(smbiosPath, F_OK) == -1)
+        if (access(mdrV1Dir, F_OK) == -1)
         {
-            int flag = mkdir(smbiosPath, S_IRWXU);
+            int flag = mkdir(mdrV1Dir, S_IRWXU);
             if (flag != 0)
             {
                 phosphor::logging::log<phosphor::logging::level::ERR>(
@@ -128,8 +131,10 @@ class MDR_V1 : sdbusplus::xyz::openbmc_project::Smbios::server::MDR_V1
 
     void regionUpdateCounter(uint8_t *count);
 
-    std::vector<std::unique_ptr<Dimm>> dimms;
-    std::vector<std::unique_ptr<Cpu>> cpus;
+    SmbiosIndex smbiosIndex;
+
+    std::vector<std::unique_ptr<Dimm<MdrV1Policy>>> dimms;
+    std::vector<std::unique_ptr<Cpu<MdrV1Policy>>> cpus;
 
     void systemInfoUpdate(void);
 
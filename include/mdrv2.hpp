@@ -19,6 +19,14 @@
 #include "dimm.hpp"
 #include "pcieslot.hpp"
 #include "smbios.hpp"
+#include "smbios_columns.hpp"
+#include "smbios_diff.hpp"
+#include "smbios_entry_point.hpp"
+#include "smbios_fields.hpp"
+#include "smbios_hash.hpp"
+#include "smbios_index.hpp"
+#include "smbios_storage.hpp"
+#include "smbios_table.hpp"
 #include "system.hpp"
 
 #include <sys/stat.h>
@@ -27,6 +35,7 @@
 
 #include <boost/asio/io_context.hpp>
 #include <boost/asio/steady_timer.hpp>
+#include <boost/asio/thread_pool.hpp>
 #include <boost/container/flat_map.hpp>
 #include <phosphor-logging/elog-errors.hpp>
 #include <phosphor-logging/lg2.hpp>
@@ -36,10 +45,17 @@
 #include <sdbusplus/timer.hpp>
 #include <xyz/openbmc_project/Smbios/MDR_V2/server.hpp>
 
+#include <bitset>
+#include <unordered_map>
+
 sdbusplus::asio::object_server& getObjectServer(void);
 
 using RecordVariant =
     std::variant<std::string, uint64_t, uint32_t, uint16_t, uint8_t>;
+/* Installed KiB, populated slots, populated slots per speed in MT/s. */
+using MemorySummary =
+    std::tuple<uint64_t, uint32_t,
+               boost::container::flat_map<uint16_t, uint32_t>>;
 namespace phosphor
 {
 namespace smbios
@@ -49,6 +65,10 @@ static constexpr const char* mdrV2Path = "/xyz/openbmc_project/Smbios/MDR_V2";
 static constexpr const char* smbiosPath = "/xyz/openbmc_project/Smbios";
 static constexpr const char* smbiosInterfaceName =
     "xyz.openbmc_project.Smbios.GetRecordType";
+static constexpr const char* rawTableInterfaceName =
+    "xyz.openbmc_project.Smbios.RawTable";
+static constexpr const char* syncInterfaceName =
+    "xyz.openbmc_project.Smbios.Sync";
 static constexpr const char* mapperBusName = "xyz.openbmc_project.ObjectMapper";
 static constexpr const char* mapperPath = "/xyz/openbmc_project/object_mapper";
 static constexpr const char* mapperInterface =
@@ -59,6 +79,40 @@ static constexpr const char* systemInterface =
     "xyz.openbmc_project.Inventory.Item.System";
 constexpr const int limitEntryLen = 0xff;
 
+static_assert(MdrV2Policy::requiredLengths[physicalMemoryArrayType] ==
+              sizeof(PhysicalMemoryArrayInfo));
+static_assert(MdrV2Policy::requiredLengths[memoryDeviceType] ==
+              sizeof(MemoryInfo));
+
+/* What a sync made of the table file. The worker thread builds it and
+ * hands it to the D-Bus thread, and nothing touches it in between.
+ */
+struct TableSnapshot
+{
+    enum class Outcome
+    {
+        /* Unreadable or unusable, the table in use stays. */
+        failed,
+        /* Holds the table in use. */
+        unchanged,
+        /* Holds a new table, decoded below. */
+        loaded,
+    };
+
+    Outcome outcome = Outcome::failed;
+    /* Whether the table file could be opened. */
+    bool fileExists = false;
+    /* Header of the table file, unless failed. */
+    MDRSMBIOSHeader header{};
+    TableFile file;
+    std::optional<VerifiedTable> table;
+    TableHash hash{};
+    SmbiosIndex index;
+    MemoryColumns memoryColumns;
+    /* Structure types that differ from the table in use. */
+    std::bitset<256> changedTypes;
+};
+
 class MDR_V2 :
     sdbusplus::server::object_t<
         sdbusplus::xyz::openbmc_project::Smbios::server::MDR_V2>
@@ -75,13 +129,18 @@ class MDR_V2 :
            boost::asio::io_context& io) :
         sdbusplus::server::object_t<
             sdbusplus::xyz::openbmc_project::Smbios::server::MDR_V2>(bus, path),
-        bus(bus), timer(io), smbiosInterface(getObjectServer().add_interface(
-                                 smbiosPath, smbiosInterfaceName))
+        bus(bus), io(io), timer(io),
+        smbiosInterface(
+            getObjectServer().add_interface(smbiosPath, smbiosInterfaceName)),
+        rawTableInterface(
+            getObjectServer().add_interface(path, rawTableInterfaceName)),
+        syncInterface(getObjectServer().add_interface(path, syncInterfaceName))
     {
 
         smbiosDir.agentVersion = smbiosAgentVersion;
         smbiosDir.dirVersion = 1;
         smbiosDir.dirEntries = 1;
+        tableFileExists = access(mdrType2File, R_OK) == 0;
         directoryEntries(smbiosDir.dirEntries);
         smbiosDir.status = 1;
         smbiosDir.remoteDirVersion = 0;
@@ -89,14 +148,36 @@ class MDR_V2 :
         std::copy(smbiosTableId.begin(), smbiosTableId.end(),
                   smbiosDir.dir[smbiosDirIndex].common.id.dataInfo);
 
-        smbiosDir.dir[smbiosDirIndex].dataStorage = smbiosTableStorage;
-
-        agentSynchronizeData();
+        smbiosDir.dir[smbiosDirIndex].dataStorage = tableFile.data().data();
 
         smbiosInterface->register_method("GetRecordType", [this](size_t type) {
             return getRecordType(type);
         });
+        smbiosInterface->register_method(
+            "GetRecordFields",
+            [this](size_t type, const std::vector<std::string>& fields) {
+                return getRecordFields(type, fields);
+            });
+        smbiosInterface->register_method(
+            "GetMemorySummary", [this]() { return getMemorySummary(); });
+        smbiosInterface->register_property_r(
+            "TableHash", std::string(),
+            sdbusplus::vtable::property_::emits_change,
+            [this](const std::string&) {
+                return tableHash ? toHex(*tableHash) : std::string();
+            });
         smbiosInterface->initialize();
+
+        rawTableInterface->register_method(
+            "GetRawTable", [this]() { return getRawTable(); });
+        rawTableInterface->initialize();
+
+        syncInterface->register_method("StartSync",
+                                       [this]() { return startSync(); });
+        syncInterface->register_signal<uint64_t, bool>("SyncFinished");
+        syncInterface->initialize();
+
+        agentSynchronizeData();
     }
 
     std::vector<uint8_t> getDirectoryInformation(uint8_t dirIndex) override;
@@ -115,43 +196,154 @@ class MDR_V2 :
 
     int findIdIndex(std::vector<uint8_t> dataInfo) override;
 
+    /** @brief Load the table file and wait for it to be published.
+     *
+     *  @return Whether the table was taken, changed or not
+     */
     bool agentSynchronizeData() override;
 
+    /** @brief Load the table file on the worker thread without waiting.
+     *
+     *  Syncs asked for while one is running are merged into the next one.
+     *  Each token is reported once, in a SyncFinished signal.
+     *
+     *  @return The token the sync is reported under
+     */
+    uint64_t startSync(void);
+
     std::vector<uint32_t>
         synchronizeDirectoryCommonData(uint8_t idIndex, uint32_t size) override;
 
     uint8_t directoryEntries(uint8_t value) override;
 
-    std::vector<boost::container::flat_map<std::string, RecordVariant>>
+    /** @brief Every structure of a type with field descriptors, decoded
+     *  once per table.
+     */
+    const std::vector<boost::container::flat_map<std::string, RecordVariant>>&
         getRecordType(size_t type);
 
-  private:
-    boost::asio::steady_timer timer;
+    /** @brief The named fields of every structure of a type, one row per
+     *  structure with the values in the order asked for.
+     *
+     *  A field the structure is too short to hold reads as 0, or as an
+     *  empty string for a string field.
+     */
+    std::vector<std::vector<RecordVariant>>
+        getRecordFields(size_t type, const std::vector<std::string>& fields);
+
+    MemorySummary getMemorySummary();
 
+    /** @brief A sealed memfd holding a RawTableHeader and the table in
+     *  use, created once per table.
+     */
+    sdbusplus::message::unix_fd getRawTable();
+
+  private:
     sdbusplus::bus_t& bus;
 
+    boost::asio::io_context& io;
+
+    boost::asio::steady_timer timer;
+
     Mdr2DirStruct smbiosDir;
 
-    bool readDataFromFlash(MDRSMBIOSHeader* mdrHdr, uint8_t* data);
-    bool checkSMBIOSVersion(uint8_t* dataIn);
+    static bool readDataFromFlash(TableFile& file, bool& fileExists);
+    static bool checkSMBIOSVersion(const SMBIOSVersion& version);
+    /** @brief Load, verify and decode the table file, on the worker thread.
+     *
+     *  Reads nothing of the daemon's state but its arguments, which the
+     *  D-Bus thread leaves alone until the snapshot is published.
+     *
+     *  @param[in] inUse     - The table the inventory was built from
+     *  @param[in] inUseHash - Its hash
+     */
+    static TableSnapshot loadTable(std::optional<VerifiedTable> inUse,
+                                   std::optional<TableHash> inUseHash);
+    /** @brief Adopt a snapshot and update the inventory, on the D-Bus
+     *  thread.
+     *
+     *  A snapshot loaded before the one last published is dropped, as the
+     *  table file it was read from has been read again since.
+     *
+     *  @param[in] snapshot - What loadTable made of the table file
+     *  @param[in] load     - The loadCount the snapshot was loaded as
+     */
+    void publishTable(TableSnapshot snapshot, uint64_t load);
+    /** @brief Load the table file for every token up to syncTokens. */
+    void runSync(void);
+    /** @brief Report tokens first to last, on the D-Bus thread. */
+    void finishSync(uint64_t first, uint64_t last, bool accepted);
+    void markLoaded(const MDRSMBIOSHeader& header);
+    void storeTableHash(void);
 
     const std::array<uint8_t, 16> smbiosTableId{
         40, 41, 42, 43, 44, 45, 46, 47, 48, 49, 50, 51, 52, 53, 54, 0x42};
-    uint8_t smbiosTableStorage[smbiosTableStorageSize];
+    /* The table the inventory was built from, copied from mdrType2File. */
+    TableFile tableFile;
+    /* Whether mdrType2File could be opened when last looked at, on start
+     * and on every sync, so the directory queries need no file I/O.
+     */
+    bool tableFileExists = false;
+    /* The part of tableFile the inventory objects were built from. */
+    std::optional<VerifiedTable> verifiedTable;
+    /* SHA-256 of verifiedTable's entry point span, published as TableHash. */
+    std::optional<TableHash> tableHash;
+    SmbiosIndex smbiosIndex;
+    MemoryColumns memoryColumns;
+    /* GetRecordType replies for smbiosIndex, by structure type. */
+    std::unordered_map<
+        uint8_t,
+        std::vector<boost::container::flat_map<std::string, RecordVariant>>>
+        recordTypeReplies;
 
     bool smbiosIsUpdating(uint8_t index);
     bool smbiosIsAvailForUpdate(uint8_t index);
     inline uint8_t smbiosValidFlag(uint8_t index);
-    void systemInfoUpdate(void);
+    /** @brief Bring the inventory objects in line with the table.
+     *
+     *  Objects are kept and re-read, so only properties whose values
+     *  differ are signalled. Objects are added or removed only when the
+     *  number of structures changes. Groups built from none of the
+     *  changed structure types are left alone, unless the motherboard
+     *  path changed.
+     *
+     *  @param[in] changedTypes - Structure types that differ from the
+     *                            table the objects were built from
+     */
+    void systemInfoUpdate(std::bitset<256> changedTypes =
+                              std::bitset<256>().set());
 
     int getTotalCpuSlot(void);
     int getTotalDimmSlot(void);
     int getTotalPcieSlot(void);
-    std::vector<std::unique_ptr<Cpu>> cpus;
-    std::vector<std::unique_ptr<Dimm>> dimms;
+    std::vector<std::unique_ptr<Cpu<MdrV2Policy>>> cpus;
+    std::vector<std::unique_ptr<Dimm<MdrV2Policy>>> dimms;
     std::vector<std::unique_ptr<Pcie>> pcies;
     std::unique_ptr<System> system;
+    std::string motherboardPath;
     std::shared_ptr<sdbusplus::asio::dbus_interface> smbiosInterface;
+    std::shared_ptr<sdbusplus::asio::dbus_interface> rawTableInterface;
+    std::shared_ptr<sdbusplus::asio::dbus_interface> syncInterface;
+    /* Tables published since the daemon started. */
+    uint64_t tableGeneration = 0;
+    /* verifiedTable as handed out by GetRawTable. */
+    std::optional<SealedTable> rawTable;
+    /* Loads of the table file posted to the worker thread. */
+    uint64_t loadCount = 0;
+    /* The load the table in use, or the last rejection, came from. */
+    uint64_t publishedLoad = 0;
+    /* The last token StartSync handed out. */
+    uint64_t syncTokens = 0;
+    /* The last token a started sync covers. Later ones wait for the next
+     * sync, as the file may have been replaced after this one read it.
+     */
+    uint64_t syncCovered = 0;
+    /* A StartSync sync is being loaded on the worker thread. */
+    bool syncRunning = false;
+    /* Declared last, so its thread is joined before the table it may
+     * still be diffing against is unmapped.
+     */
+    boost::asio::thread_pool worker{1};
 };
 
 } // namespace smbios
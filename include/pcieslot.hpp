@@ -1,5 +1,7 @@
 #pragma once
 #include "smbios.hpp"
+#include "smbios_index.hpp"
+#include "smbios_table.hpp"
 
 #include <xyz/openbmc_project/Association/Definitions/server.hpp>
 #include <xyz/openbmc_project/Inventory/Connector/Embedded/server.hpp>
@@ -9,6 +11,8 @@
 
 #include <cstdint>
 #include <map>
+#include <ranges>
+#include <string_view>
 #include <unordered_set>
 
 namespace phosphor
@@ -43,23 +47,37 @@ class Pcie :
     ~Pcie() = default;
 
     Pcie(sdbusplus::bus_t& bus, const std::string& objPath,
-         const uint8_t& pcieId, uint8_t* smbiosTableStorage,
+         const uint8_t& pcieId, const SmbiosIndex& index,
          const std::string& motherboard) :
         sdbusplus::server::object_t<PCIeSlot, location, embedded, item,
-                                    association>(bus, objPath.c_str()),
-        pcieNum(pcieId), storage(smbiosTableStorage),
-        motherboardPath(motherboard)
+                                    association>(
+            bus, objPath.c_str(),
+            sdbusplus::server::object_t<PCIeSlot, location, embedded, item,
+                                        association>::action::defer_emit),
+        pcieNum(pcieId), smbiosIndex(index), motherboardPath(motherboard)
     {
         pcieInfoUpdate();
+        skipSignal = false;
+        emit_object_added();
     }
 
     void pcieInfoUpdate();
 
+    /** @brief Re-read the slot after a sync, keeping the object. */
+    void refresh(const std::string& motherboard)
+    {
+        motherboardPath = motherboard;
+        pcieInfoUpdate();
+    }
+
   private:
     uint8_t pcieNum;
-    uint8_t* storage;
+    const SmbiosIndex& smbiosIndex;
     std::string motherboardPath;
 
+    /* Set until the populated object is announced with InterfacesAdded. */
+    bool skipSignal = true;
+
     struct SystemSlotInfo
     {
         uint8_t type;
@@ -82,8 +100,7 @@ class Pcie :
     void pcieType(const uint8_t type);
     void pcieLaneSize(const uint8_t width);
     void pcieIsHotPluggable(const uint8_t characteristics);
-    void pcieLocation(const uint8_t slotDesignation, const uint8_t structLen,
-                      uint8_t* dataIn);
+    void pcieLocation(std::string_view slotDesignation);
 };
 
 static const std::unordered_set<uint8_t> pcieSmbiosType = {
@@ -93,6 +110,14 @@ static const std::unordered_set<uint8_t> pcieSmbiosType = {
     0xb2, 0xb3, 0xb4, 0xb5, 0xb6, 0xb7, 0xb8, 0xb9, 0xba, 0xbb, 0xbc, 0xbd,
     0xbe, 0xbf, 0xc0, 0xc1, 0xc2, 0xc3, 0xc4, 0xc5, 0xc6};
 
+/* System slot type offset. Check if the slot is a PCIE slots. All PCIE slot
+ * type are hardcoded in a table.
+ */
+static inline bool isPcieSlot(const Structure& slot)
+{
+    return pcieSmbiosType.find(*(slot.data() + 5)) != pcieSmbiosType.end();
+}
+
 // Definition follow smbios spec DSP0134 3.4.0
 static const std::map<uint8_t, PCIeGeneration> pcieGenerationTable = {
     {0x09, PCIeGeneration::Unknown}, {0x14, PCIeGeneration::Gen3},
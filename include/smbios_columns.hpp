@@ -0,0 +1,289 @@
+#pragma once
+
+#include "smbios_parse.hpp"
+#include "smbios_fields.hpp"
+#include "smbios_index.hpp"
+#include "smbios_table.hpp"
+
+#include <boost/container/flat_map.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace phosphor
+{
+
+namespace smbios
+{
+
+/**
+ * @brief Decode every structure of Columns::type into Columns.
+ *
+ * Columns holds one vector per decoded field, so totals across all
+ * records scan contiguous arrays instead of walking the table again.
+ * Decoding reuses the vectors' storage from the previous generation.
+ */
+template <typename Columns>
+void decodeColumns(const SmbiosIndex& index, Columns& columns)
+{
+    columns.clear();
+    columns.reserve(index.count(Columns::type));
+    for (Structure structure : index.structures(Columns::type))
+    {
+        columns.append(structure);
+    }
+}
+
+/** @brief Memory device (type 17) fields, one element per record. */
+struct MemoryColumns
+{
+    static constexpr uint8_t type = memoryDeviceType;
+
+    std::vector<uint16_t> handle;
+    /* Installed size in KiB, 0 for an empty slot or an unknown size. */
+    std::vector<uint64_t> sizeKiB;
+    /* Maximum and configured speed in MT/s, 0 if unknown. */
+    std::vector<uint16_t> speed;
+    std::vector<uint16_t> configuredSpeed;
+    std::vector<uint8_t> memoryType;
+    /* String number of the device locator. */
+    std::vector<uint8_t> locator;
+
+    void append(const Structure& structure)
+    {
+        handle.push_back(structure.handle());
+        sizeKiB.push_back(decodeSize(structure));
+        speed.push_back(MemoryDeviceFields::speed.get(structure));
+        configuredSpeed.push_back(
+            MemoryDeviceFields::configuredSpeed.get(structure));
+        memoryType.push_back(MemoryDeviceFields::memoryType.get(structure));
+        locator.push_back(MemoryDeviceFields::deviceLocator.get(structure));
+    }
+
+    void reserve(size_t count)
+    {
+        handle.reserve(count);
+        sizeKiB.reserve(count);
+        speed.reserve(count);
+        configuredSpeed.reserve(count);
+        memoryType.reserve(count);
+        locator.reserve(count);
+    }
+
+    void clear()
+    {
+        handle.clear();
+        sizeKiB.clear();
+        speed.clear();
+        configuredSpeed.clear();
+        memoryType.clear();
+        locator.clear();
+    }
+
+    size_t size() const
+    {
+        return handle.size();
+    }
+
+    /** @brief Installed memory across all devices, in KiB. */
+    uint64_t totalSizeKiB() const
+    {
+        uint64_t total = 0;
+        for (uint64_t size : sizeKiB)
+        {
+            total += size;
+        }
+        return total;
+    }
+
+    /** @brief Number of slots holding a device of known size. */
+    size_t populated() const
+    {
+        size_t count = 0;
+        for (uint64_t size : sizeKiB)
+        {
+            count += size != 0;
+        }
+        return count;
+    }
+
+    /** @brief Populated slots per maximum speed. */
+    boost::container::flat_map<uint16_t, uint32_t> countBySpeed() const
+    {
+        boost::container::flat_map<uint16_t, uint32_t> counts;
+        for (size_t index = 0; index < size(); index++)
+        {
+            if (sizeKiB[index] != 0)
+            {
+                counts[speed[index]]++;
+            }
+        }
+        return counts;
+    }
+
+  private:
+    static constexpr uint16_t sizeUnknown = 0xffff;
+    static constexpr uint16_t sizeExtended = 0x7fff;
+    static constexpr uint16_t sizeInKiB = 0x8000;
+
+    static uint64_t decodeSize(const Structure& structure)
+    {
+        uint16_t size = MemoryDeviceFields::size.get(structure);
+        if (size == sizeUnknown)
+        {
+            return 0;
+        }
+        if (size == sizeExtended)
+        {
+            uint32_t extended = MemoryDeviceFields::extendedSize.get(structure);
+            return uint64_t(extended & 0x7fffffff) * 1024;
+        }
+        if (size & sizeInKiB)
+        {
+            return size & ~sizeInKiB;
+        }
+        return uint64_t(size) * 1024;
+    }
+};
+
+/** @brief Processor (type 4) fields, one element per record. */
+struct ProcessorColumns
+{
+    static constexpr uint8_t type = processorsType;
+
+    std::vector<uint16_t> handle;
+    std::vector<uint8_t> populated;
+    /* Family, with the family 2 field resolved. */
+    std::vector<uint16_t> family;
+    std::vector<uint16_t> maxSpeed;
+    std::vector<uint16_t> coreCount;
+    std::vector<uint16_t> threadCount;
+
+    void append(const Structure& structure)
+    {
+        constexpr uint8_t socketPopulated = 1 << 6;
+        constexpr uint8_t family2Indicator = 0xfe;
+        constexpr uint8_t useCount2 = 0xff;
+
+        handle.push_back(structure.handle());
+        populated.push_back(
+            (ProcessorFields::status.get(structure) & socketPopulated) != 0);
+        uint8_t family1 = ProcessorFields::family.get(structure);
+        family.push_back(family1 == family2Indicator
+                             ? ProcessorFields::family2.get(structure)
+                             : family1);
+        maxSpeed.push_back(ProcessorFields::maxSpeed.get(structure));
+        uint8_t cores = ProcessorFields::coreCount.get(structure);
+        coreCount.push_back(cores == useCount2
+                                ? ProcessorFields::coreCount2.get(structure)
+                                : cores);
+        uint8_t threads = ProcessorFields::threadCount.get(structure);
+        threadCount.push_back(
+            threads == useCount2 ? ProcessorFields::threadCount2.get(structure)
+                                 : threads);
+    }
+
+    void reserve(size_t count)
+    {
+        handle.reserve(count);
+        populated.reserve(count);
+        family.reserve(count);
+        maxSpeed.reserve(count);
+        coreCount.reserve(count);
+        threadCount.reserve(count);
+    }
+
+    void clear()
+    {
+        handle.clear();
+        populated.clear();
+        family.clear();
+        maxSpeed.clear();
+        coreCount.clear();
+        threadCount.clear();
+    }
+
+    size_t size() const
+    {
+        return handle.size();
+    }
+
+    /** @brief Cores across populated sockets. */
+    uint32_t totalCores() const
+    {
+        uint32_t total = 0;
+        for (size_t index = 0; index < size(); index++)
+        {
+            total += populated[index] ? coreCount[index] : 0;
+        }
+        return total;
+    }
+
+    /** @brief Threads across populated sockets. */
+    uint32_t totalThreads() const
+    {
+        uint32_t total = 0;
+        for (size_t index = 0; index < size(); index++)
+        {
+            total += populated[index] ? threadCount[index] : 0;
+        }
+        return total;
+    }
+};
+
+/** @brief System slot (type 9) fields, one element per record. */
+struct SlotColumns
+{
+    static constexpr uint8_t type = systemSlots;
+
+    std::vector<uint16_t> handle;
+    std::vector<uint8_t> slotType;
+    std::vector<uint8_t> dataBusWidth;
+    std::vector<uint8_t> currentUsage;
+
+    void append(const Structure& structure)
+    {
+        handle.push_back(structure.handle());
+        slotType.push_back(SystemSlotFields::slotType.get(structure));
+        dataBusWidth.push_back(SystemSlotFields::dataBusWidth.get(structure));
+        currentUsage.push_back(SystemSlotFields::currentUsage.get(structure));
+    }
+
+    void reserve(size_t count)
+    {
+        handle.reserve(count);
+        slotType.reserve(count);
+        dataBusWidth.reserve(count);
+        currentUsage.reserve(count);
+    }
+
+    void clear()
+    {
+        handle.clear();
+        slotType.clear();
+        dataBusWidth.clear();
+        currentUsage.clear();
+    }
+
+    size_t size() const
+    {
+        return handle.size();
+    }
+
+    /** @brief Number of slots the firmware reports in use. */
+    size_t inUse() const
+    {
+        constexpr uint8_t usageInUse = 0x04;
+        size_t count = 0;
+        for (uint8_t usage : currentUsage)
+        {
+            count += usage == usageInUse;
+        }
+        return count;
+    }
+};
+
+} // namespace smbios
+
+} // namespace phosphor
@@ -0,0 +1,67 @@
+#pragma once
+
+#include "smbios_table.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+#include <vector>
+
+namespace phosphor
+{
+
+namespace smbios
+{
+
+/* A structure named by what the diff matches on. */
+struct StructureKey
+{
+    uint8_t type;
+    uint16_t handle;
+
+    bool operator==(const StructureKey&) const = default;
+};
+
+/* A structure present in both tables whose contents differ. */
+struct StructureChange
+{
+    StructureKey key;
+    /* Names of the described fields whose values differ, in layout order.
+     * Strings are compared by content, not by string number. Empty when
+     * the type has no field descriptors or only undescribed bytes differ.
+     */
+    std::vector<std::string_view> fields;
+};
+
+/* What changed between two generations of a table, each list in the order
+ * of the table the structures come from.
+ */
+struct TableDiff
+{
+    std::vector<StructureKey> added;
+    std::vector<StructureKey> removed;
+    std::vector<StructureChange> changed;
+
+    bool empty() const
+    {
+        return added.empty() && removed.empty() && changed.empty();
+    }
+};
+
+/**
+ * @brief Compare two tables structure by structure.
+ *
+ * Structures are matched by type and handle, so a handle that now names a
+ * structure of another type is reported as removed and added. Identical
+ * tables are recognised with a single compare; otherwise each table is
+ * walked once and only structures whose bytes differ are decoded.
+ *
+ * @param[in] previous - Table the inventory was built from
+ * @param[in] current  - Table just received from the host
+ */
+TableDiff diffTables(const VerifiedTable& previous,
+                     const VerifiedTable& current);
+
+} // namespace smbios
+
+} // namespace phosphor
@@ -0,0 +1,69 @@
+#pragma once
+
+#include "smbios_parse.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace phosphor
+{
+
+namespace smbios
+{
+
+namespace dump
+{
+
+enum class Format
+{
+    /* One JSON object per file, on one line. */
+    json,
+    /* One row per decoded field: file,type,handle,field,value. */
+    csv,
+};
+
+/* Span of the structure table in a file. */
+struct TableLocation
+{
+    size_t offset;
+    size_t size;
+    /* Version from the entry point, unknown for a bare table. */
+    std::optional<SMBIOSVersion> version;
+};
+
+/**
+ * @brief Find the structure table in the contents of a file.
+ *
+ * Accepts the files written by SmbiosBlobHandler::commit, an
+ * MDRSMBIOSHeader followed by the region data, as well as region copies
+ * and dmidecode --dump-bin images that start with or hold an entry point.
+ * Anything else is taken to be a bare structure table.
+ */
+TableLocation locateTable(const uint8_t* data, size_t size);
+
+/** @brief Append the CSV column names. */
+void appendCsvHeader(std::string& out);
+
+/**
+ * @brief Decode every structure type with field descriptors.
+ *
+ * @param[in] name   - File name written with the records
+ * @param[in] data   - Contents of the file
+ * @param[in] format - Output format
+ * @param[out] out   - Output the records are appended to
+ * @param[out] error - Why the file could not be decoded
+ *
+ * @return false, leaving out unchanged, if the table is malformed.
+ */
+bool dumpTable(std::string_view name, std::vector<uint8_t>& data,
+               Format format, std::string& out, std::string& error);
+
+} // namespace dump
+
+} // namespace smbios
+
+} // namespace phosphor
@@ -0,0 +1,46 @@
+#pragma once
+
+#include "smbios_parse.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+
+namespace phosphor
+{
+
+namespace smbios
+{
+
+/* Location of the structure table described by an entry point. */
+struct EntryPoint
+{
+    SMBIOSVersion version;
+    /* Offset of the entry point structure in the data. */
+    size_t offset;
+    size_t length;
+    /* Span of the structure table in the data. */
+    size_t tableOffset;
+    size_t tableSize;
+};
+
+/**
+ * @brief Find a valid SMBIOS entry point and the table it describes.
+ *
+ * Only 16-byte aligned offsets are checked for the "_SM3_" and "_SM_"
+ * anchors, as the specification places entry points on paragraph
+ * boundaries, and the data is read in place. Anchors whose checksums do
+ * not add up are skipped. A 3.0 entry point is preferred over a 2.1 one.
+ *
+ * @param[in] data        - MDR data holding the entry point and the table
+ * @param[in] size        - Size of the data
+ * @param[in] baseAddress - Host address the data was copied from
+ *
+ * @return The entry point, or std::nullopt if there is no valid one.
+ */
+std::optional<EntryPoint> findEntryPoint(const uint8_t* data, size_t size,
+                                         uint64_t baseAddress = 0);
+
+} // namespace smbios
+
+} // namespace phosphor
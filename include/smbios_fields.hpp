@@ -0,0 +1,637 @@
+#pragma once
+
+#include "smbios_parse.hpp"
+#include "smbios_table.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <optional>
+#include <string_view>
+#include <tuple>
+
+namespace phosphor
+{
+
+namespace smbios
+{
+
+/* How a field's raw value is interpreted. */
+enum class FieldKind
+{
+    number,
+    string, // 1-based index into the structure's string set
+    handle, // handle of another structure
+};
+
+/** @brief A DSP0134 version as major << 8 | minor. */
+static constexpr uint16_t specVersion(uint8_t major, uint8_t minor)
+{
+    return static_cast<uint16_t>(major << 8 | minor);
+}
+
+/**
+ * @brief Compile-time description of one field of an SMBIOS structure.
+ *
+ * T is the field as laid out in the table. Value is the type it is
+ * published as, which defaults to T.
+ */
+template <typename T, FieldKind Kind = FieldKind::number, typename Value = T>
+struct Field
+{
+    using type = T;
+    using value_type = Value;
+    static constexpr FieldKind kind = Kind;
+    static constexpr size_t width = sizeof(T);
+
+    const char* name;
+    uint8_t offset;
+    /* First version of the specification defining the field. */
+    uint16_t version;
+
+    constexpr size_t end() const
+    {
+        return offset + width;
+    }
+
+    /** @brief Whether the structure is long enough to hold the field. */
+    bool present(const Structure& structure) const
+    {
+        return end() <= structure.length();
+    }
+
+    /** @brief The raw value, or std::nullopt if the structure is too short.
+     *  String fields yield their string number.
+     */
+    std::optional<Value> read(const Structure& structure) const
+    {
+        if (!present(structure))
+        {
+            return std::nullopt;
+        }
+        T raw;
+        std::memcpy(&raw, structure.data() + offset, width);
+        return static_cast<Value>(raw);
+    }
+
+    /** @brief The raw value, or 0 if the structure is too short. */
+    Value get(const Structure& structure) const
+    {
+        return read(structure).value_or(Value{});
+    }
+};
+
+using StringField = Field<uint8_t, FieldKind::string>;
+using HandleField = Field<uint16_t, FieldKind::handle>;
+
+/**
+ * @brief Shortest structure holding every field defined up to version.
+ *
+ * @param[in] fields  - Tuple of Field descriptors of one structure type
+ * @param[in] version - Specification version, from specVersion()
+ */
+template <typename Fields>
+constexpr size_t lengthThrough(const Fields& fields, uint16_t version)
+{
+    return std::apply(
+        [version](const auto&... field) {
+            size_t length = structureHeaderLen;
+            ((length = field.version <= version
+                           ? std::max(length, field.end())
+                           : length),
+             ...);
+            return length;
+        },
+        fields);
+}
+
+/**
+ * @brief Shortest structure holding each of the given fields.
+ *
+ * For readers that use a few fields of a type rather than all of one
+ * specification version.
+ */
+template <typename... Fields>
+constexpr size_t lengthCovering(const Fields&... fields)
+{
+    return std::max({static_cast<size_t>(structureHeaderLen), fields.end()...});
+}
+
+namespace internal
+{
+
+template <typename F, typename Visitor>
+static inline void visitField(const Structure& structure,
+                              const SmbiosStrings& strings, const F& field,
+                              Visitor& visitor)
+{
+    std::optional<typename F::value_type> value = field.read(structure);
+    if (!value)
+    {
+        return;
+    }
+    if constexpr (F::kind == FieldKind::string)
+    {
+        visitor(field, strings[*value]);
+    }
+    else
+    {
+        visitor(field, *value);
+    }
+}
+
+} // namespace internal
+
+/**
+ * @brief Decode every field the structure is long enough to hold, in one
+ * pass.
+ *
+ * The visitor is called as visitor(field, value) for each present field.
+ * String fields pass the string itself as a std::string_view into the
+ * table; the string set is indexed once for the whole structure.
+ *
+ * @param[in] structure - Structure of the type fields describes
+ * @param[in] fields    - Tuple of Field descriptors
+ * @param[in] visitor   - Callable accepting each field and its value
+ */
+template <typename Fields, typename Visitor>
+void decodeFields(const Structure& structure, const Fields& fields,
+                  Visitor&& visitor)
+{
+    SmbiosStrings strings = structure.strings();
+    std::apply(
+        [&](const auto&... field) {
+            (internal::visitField(structure, strings, field, visitor), ...);
+        },
+        fields);
+}
+
+/* Field layouts from DSP0134. The header fields are listed for each type
+ * so a decoded record is self-describing.
+ */
+
+struct BiosFields
+{
+    static constexpr Field<uint8_t> type{"Type", 0x00, specVersion(2, 0)};
+    static constexpr Field<uint8_t> length{"Length", 0x01, specVersion(2, 0)};
+    static constexpr HandleField handle{"Handle", 0x02, specVersion(2, 0)};
+    static constexpr StringField vendor{"Vendor", 0x04, specVersion(2, 0)};
+    static constexpr StringField version{"BIOS Version", 0x05,
+                                         specVersion(2, 0)};
+    static constexpr Field<uint16_t> startSegment{
+        "BIOS Starting Address Segment", 0x06, specVersion(2, 0)};
+    static constexpr StringField releaseDate{"BIOS Release Date", 0x08,
+                                             specVersion(2, 0)};
+    static constexpr Field<uint8_t> romSize{"BIOS ROM Size", 0x09,
+                                            specVersion(2, 0)};
+    static constexpr Field<uint64_t> characteristics{
+        "BIOS Characteristics", 0x0a, specVersion(2, 0)};
+    static constexpr Field<uint16_t> characteristicsExtension{
+        "BIOS Characteristics Extension Bytes", 0x12, specVersion(2, 4)};
+    static constexpr Field<uint8_t> biosMajor{"System BIOS Major Release",
+                                              0x14, specVersion(2, 4)};
+    static constexpr Field<uint8_t> biosMinor{"System BIOS Minor Release",
+                                              0x15, specVersion(2, 4)};
+    static constexpr Field<uint8_t> firmwareMajor{
+        "Embedded Controller Firmware Major Release", 0x16, specVersion(2, 4)};
+    static constexpr Field<uint8_t> firmwareMinor{
+        "Embedded Controller Firmware Minor Release", 0x17, specVersion(2, 4)};
+
+    static constexpr auto all =
+        std::make_tuple(type, length, handle, vendor, version, startSegment,
+                        releaseDate, romSize, characteristics,
+                        characteristicsExtension, biosMajor, biosMinor,
+                        firmwareMajor, firmwareMinor);
+};
+
+struct SystemFields
+{
+    static constexpr Field<uint8_t> type{"Type", 0x00, specVersion(2, 0)};
+    static constexpr Field<uint8_t> length{"Length", 0x01, specVersion(2, 0)};
+    static constexpr HandleField handle{"Handle", 0x02, specVersion(2, 0)};
+    static constexpr StringField manufacturer{"Manufacturer", 0x04,
+                                              specVersion(2, 0)};
+    static constexpr StringField productName{"Product Name", 0x05,
+                                             specVersion(2, 0)};
+    static constexpr StringField version{"Version", 0x06, specVersion(2, 0)};
+    static constexpr StringField serialNumber{"Serial Number", 0x07,
+                                              specVersion(2, 0)};
+    // The 16-byte UUID at 0x08 is read by System directly.
+    static constexpr Field<uint8_t> wakeUpType{"Wake-up Type", 0x18,
+                                               specVersion(2, 1)};
+    static constexpr StringField skuNumber{"SKU Number", 0x19,
+                                           specVersion(2, 4)};
+    static constexpr StringField family{"Family", 0x1a, specVersion(2, 4)};
+
+    static constexpr auto all =
+        std::make_tuple(type, length, handle, manufacturer, productName,
+                        version, serialNumber, wakeUpType, skuNumber, family);
+};
+
+struct BaseboardFields
+{
+    static constexpr Field<uint8_t> type{"Type", 0x00, specVersion(2, 0)};
+    static constexpr Field<uint8_t> length{"Length", 0x01, specVersion(2, 0)};
+    static constexpr HandleField handle{"Handle", 0x02, specVersion(2, 0)};
+    static constexpr StringField manufacturer{"Manufacturer", 0x04,
+                                              specVersion(2, 0)};
+    static constexpr StringField product{"Product", 0x05, specVersion(2, 0)};
+    static constexpr StringField version{"Version", 0x06, specVersion(2, 0)};
+    static constexpr StringField serialNumber{"Serial Number", 0x07,
+                                              specVersion(2, 0)};
+    static constexpr StringField assetTag{"Asset Tag", 0x08,
+                                          specVersion(2, 0)};
+    static constexpr Field<uint8_t> featureFlags{"Feature Flags", 0x09,
+                                                 specVersion(2, 0)};
+    static constexpr StringField locationInChassis{"Location in Chassis",
+                                                   0x0a, specVersion(2, 0)};
+    static constexpr HandleField chassisHandle{"Chassis Handle", 0x0b,
+                                               specVersion(2, 0)};
+    static constexpr Field<uint8_t> boardType{"Board Type", 0x0d,
+                                              specVersion(2, 0)};
+    // The contained object handles that follow are not decoded.
+    static constexpr Field<uint8_t> containedObjects{
+        "Number of Contained Object Handles", 0x0e, specVersion(2, 0)};
+
+    static constexpr auto all = std::make_tuple(
+        type, length, handle, manufacturer, product, version, serialNumber,
+        assetTag, featureFlags, locationInChassis, chassisHandle, boardType,
+        containedObjects);
+};
+
+struct ChassisFields
+{
+    static constexpr Field<uint8_t> type{"Type", 0x00, specVersion(2, 0)};
+    static constexpr Field<uint8_t> length{"Length", 0x01, specVersion(2, 0)};
+    static constexpr HandleField handle{"Handle", 0x02, specVersion(2, 0)};
+    static constexpr StringField manufacturer{"Manufacturer", 0x04,
+                                              specVersion(2, 0)};
+    static constexpr Field<uint8_t> chassisType{"Chassis Type", 0x05,
+                                                specVersion(2, 0)};
+    static constexpr StringField version{"Version", 0x06, specVersion(2, 0)};
+    static constexpr StringField serialNumber{"Serial Number", 0x07,
+                                              specVersion(2, 0)};
+    static constexpr StringField assetTag{"Asset Tag Number", 0x08,
+                                          specVersion(2, 0)};
+    static constexpr Field<uint8_t> bootUpState{"Boot-up State", 0x09,
+                                                specVersion(2, 1)};
+    static constexpr Field<uint8_t> powerSupplyState{"Power Supply State",
+                                                     0x0a, specVersion(2, 1)};
+    static constexpr Field<uint8_t> thermalState{"Thermal State", 0x0b,
+                                                 specVersion(2, 1)};
+    static constexpr Field<uint8_t> securityStatus{"Security Status", 0x0c,
+                                                   specVersion(2, 1)};
+    static constexpr Field<uint32_t> oemDefined{"OEM-defined", 0x0d,
+                                                specVersion(2, 3)};
+    static constexpr Field<uint8_t> height{"Height", 0x11, specVersion(2, 3)};
+    static constexpr Field<uint8_t> powerCords{"Number of Power Cords", 0x12,
+                                               specVersion(2, 3)};
+    // The contained elements and the SKU number after them are not
+    // decoded, their offsets depend on these two fields.
+    static constexpr Field<uint8_t> containedElementCount{
+        "Contained Element Count", 0x13, specVersion(2, 3)};
+    static constexpr Field<uint8_t> containedElementLength{
+        "Contained Element Record Length", 0x14, specVersion(2, 3)};
+
+    static constexpr auto all = std::make_tuple(
+        type, length, handle, manufacturer, chassisType, version, serialNumber,
+        assetTag, bootUpState, powerSupplyState, thermalState, securityStatus,
+        oemDefined, height, powerCords, containedElementCount,
+        containedElementLength);
+};
+
+struct ProcessorFields
+{
+    static constexpr Field<uint8_t> type{"Type", 0x00, specVersion(2, 0)};
+    static constexpr Field<uint8_t> length{"Length", 0x01, specVersion(2, 0)};
+    static constexpr HandleField handle{"Handle", 0x02, specVersion(2, 0)};
+    static constexpr StringField socket{"Socket Designation", 0x04,
+                                        specVersion(2, 0)};
+    static constexpr Field<uint8_t> processorType{"Processor Type", 0x05,
+                                                  specVersion(2, 0)};
+    static constexpr Field<uint8_t> family{"Processor Family", 0x06,
+                                           specVersion(2, 0)};
+    static constexpr StringField manufacturer{"Processor Manufacturer", 0x07,
+                                              specVersion(2, 0)};
+    static constexpr Field<uint64_t> id{"Processor ID", 0x08,
+                                        specVersion(2, 0)};
+    static constexpr StringField version{"Processor Version", 0x10,
+                                         specVersion(2, 0)};
+    static constexpr Field<uint8_t> voltage{"Voltage", 0x11,
+                                            specVersion(2, 0)};
+    static constexpr Field<uint16_t> externalClock{"External Clock", 0x12,
+                                                   specVersion(2, 0)};
+    static constexpr Field<uint16_t> maxSpeed{"Max Speed", 0x14,
+                                              specVersion(2, 0)};
+    static constexpr Field<uint16_t> currentSpeed{"Current Speed", 0x16,
+                                                  specVersion(2, 0)};
+    static constexpr Field<uint8_t> status{"Status", 0x18, specVersion(2, 0)};
+    static constexpr Field<uint8_t> upgrade{"Processor Upgrade", 0x19,
+                                            specVersion(2, 0)};
+    static constexpr HandleField l1Handle{"L1 Cache Handle", 0x1a,
+                                          specVersion(2, 1)};
+    static constexpr HandleField l2Handle{"L2 Cache Handle", 0x1c,
+                                          specVersion(2, 1)};
+    static constexpr HandleField l3Handle{"L3 Cache Handle", 0x1e,
+                                          specVersion(2, 1)};
+    static constexpr StringField serialNumber{"Serial Number", 0x20,
+                                              specVersion(2, 3)};
+    static constexpr StringField assetTag{"Asset Tag", 0x21,
+                                          specVersion(2, 3)};
+    static constexpr StringField partNumber{"Part Number", 0x22,
+                                            specVersion(2, 3)};
+    static constexpr Field<uint8_t> coreCount{"Core Count", 0x23,
+                                              specVersion(2, 5)};
+    static constexpr Field<uint8_t> coreEnabled{"Core Enabled", 0x24,
+                                                specVersion(2, 5)};
+    static constexpr Field<uint8_t> threadCount{"Thread Count", 0x25,
+                                                specVersion(2, 5)};
+    static constexpr Field<uint16_t> characteristics{
+        "Processor Characteristics", 0x26, specVersion(2, 5)};
+    static constexpr Field<uint16_t> family2{"Processor Family 2", 0x28,
+                                             specVersion(2, 6)};
+    static constexpr Field<uint16_t> coreCount2{"Core Count 2", 0x2a,
+                                                specVersion(3, 0)};
+    static constexpr Field<uint16_t> coreEnabled2{"Core Enabled 2", 0x2c,
+                                                  specVersion(3, 0)};
+    static constexpr Field<uint16_t> threadCount2{"Thread Count 2", 0x2e,
+                                                  specVersion(3, 0)};
+
+    static constexpr auto all = std::make_tuple(
+        type, length, handle, socket, processorType, family, manufacturer, id,
+        version, voltage, externalClock, maxSpeed, currentSpeed, status,
+        upgrade, l1Handle, l2Handle, l3Handle, serialNumber, assetTag,
+        partNumber, coreCount, coreEnabled, threadCount, characteristics,
+        family2, coreCount2, coreEnabled2, threadCount2);
+};
+
+struct CacheFields
+{
+    static constexpr Field<uint8_t> type{"Type", 0x00, specVersion(2, 0)};
+    static constexpr Field<uint8_t> length{"Length", 0x01, specVersion(2, 0)};
+    static constexpr HandleField handle{"Handle", 0x02, specVersion(2, 0)};
+    static constexpr StringField socket{"Socket Designation", 0x04,
+                                        specVersion(2, 0)};
+    static constexpr Field<uint16_t> configuration{"Cache Configuration",
+                                                   0x05, specVersion(2, 0)};
+    static constexpr Field<uint16_t> maximumSize{"Maximum Cache Size", 0x07,
+                                                 specVersion(2, 0)};
+    static constexpr Field<uint16_t> installedSize{"Installed Size", 0x09,
+                                                   specVersion(2, 0)};
+    static constexpr Field<uint16_t> supportedSramType{"Supported SRAM Type",
+                                                       0x0b, specVersion(2, 0)};
+    static constexpr Field<uint16_t> currentSramType{"Current SRAM Type", 0x0d,
+                                                     specVersion(2, 0)};
+    static constexpr Field<uint8_t> speed{"Cache Speed", 0x0f,
+                                          specVersion(2, 1)};
+    static constexpr Field<uint8_t> errorCorrection{"Error Correction Type",
+                                                    0x10, specVersion(2, 1)};
+    static constexpr Field<uint8_t> systemCacheType{"System Cache Type", 0x11,
+                                                    specVersion(2, 1)};
+    static constexpr Field<uint8_t> associativity{"Associativity", 0x12,
+                                                  specVersion(2, 1)};
+    static constexpr Field<uint32_t> maximumSize2{"Maximum Cache Size 2", 0x13,
+                                                  specVersion(3, 1)};
+    static constexpr Field<uint32_t> installedSize2{"Installed Cache Size 2",
+                                                    0x17, specVersion(3, 1)};
+
+    static constexpr auto all = std::make_tuple(
+        type, length, handle, socket, configuration, maximumSize,
+        installedSize, supportedSramType, currentSramType, speed,
+        errorCorrection, systemCacheType, associativity, maximumSize2,
+        installedSize2);
+};
+
+struct SystemSlotFields
+{
+    static constexpr Field<uint8_t> type{"Type", 0x00, specVersion(2, 0)};
+    static constexpr Field<uint8_t> length{"Length", 0x01, specVersion(2, 0)};
+    static constexpr HandleField handle{"Handle", 0x02, specVersion(2, 0)};
+    static constexpr StringField designation{"Slot Designation", 0x04,
+                                             specVersion(2, 0)};
+    static constexpr Field<uint8_t> slotType{"Slot Type", 0x05,
+                                             specVersion(2, 0)};
+    static constexpr Field<uint8_t> dataBusWidth{"Slot Data Bus Width", 0x06,
+                                                 specVersion(2, 0)};
+    static constexpr Field<uint8_t> currentUsage{"Current Usage", 0x07,
+                                                 specVersion(2, 0)};
+    static constexpr Field<uint8_t> slotLength{"Slot Length", 0x08,
+                                               specVersion(2, 0)};
+    static constexpr Field<uint16_t> slotId{"Slot ID", 0x09,
+                                            specVersion(2, 0)};
+    static constexpr Field<uint8_t> characteristics1{"Slot Characteristics 1",
+                                                     0x0b, specVersion(2, 0)};
+    static constexpr Field<uint8_t> characteristics2{"Slot Characteristics 2",
+                                                     0x0c, specVersion(2, 1)};
+    static constexpr Field<uint16_t> segmentGroup{"Segment Group Number",
+                                                  0x0d, specVersion(2, 6)};
+    static constexpr Field<uint8_t> busNumber{"Bus Number", 0x0f,
+                                              specVersion(2, 6)};
+    static constexpr Field<uint8_t> deviceFunction{
+        "Device/Function Number", 0x10, specVersion(2, 6)};
+
+    static constexpr auto all = std::make_tuple(
+        type, length, handle, designation, slotType, dataBusWidth,
+        currentUsage, slotLength, slotId, characteristics1, characteristics2,
+        segmentGroup, busNumber, deviceFunction);
+};
+
+struct PhysicalMemoryArrayFields
+{
+    static constexpr Field<uint8_t> type{"Type", 0x00, specVersion(2, 0)};
+    static constexpr Field<uint8_t> length{"Length", 0x01, specVersion(2, 0)};
+    static constexpr HandleField handle{"Handle", 0x02, specVersion(2, 0)};
+    static constexpr Field<uint8_t> location{"Location", 0x04,
+                                             specVersion(2, 1)};
+    static constexpr Field<uint8_t> use{"Use", 0x05, specVersion(2, 1)};
+    static constexpr Field<uint8_t> errorCorrection{
+        "Memory Error Correction", 0x06, specVersion(2, 1)};
+    static constexpr Field<uint32_t> maximumCapacity{"Maximum Capacity", 0x07,
+                                                     specVersion(2, 1)};
+    static constexpr HandleField errorInformationHandle{
+        "Memory Error Information Handle", 0x0b, specVersion(2, 1)};
+    static constexpr Field<uint16_t> numberOfDevices{
+        "Number of Memory Devices", 0x0d, specVersion(2, 1)};
+    static constexpr Field<uint64_t> extendedMaximumCapacity{
+        "Extended Maximum Capacity", 0x0f, specVersion(2, 7)};
+
+    static constexpr auto all = std::make_tuple(
+        type, length, handle, location, use, errorCorrection, maximumCapacity,
+        errorInformationHandle, numberOfDevices, extendedMaximumCapacity);
+};
+
+/* The names and published types are those GetRecordType has always
+ * returned for type 17.
+ */
+struct MemoryDeviceFields
+{
+    static constexpr Field<uint8_t> type{"Type", 0x00, specVersion(2, 0)};
+    static constexpr Field<uint8_t> length{"Length", 0x01, specVersion(2, 0)};
+    static constexpr HandleField handle{"Handle", 0x02, specVersion(2, 0)};
+    static constexpr HandleField arrayHandle{"Physical Memory Array Handle",
+                                             0x04, specVersion(2, 1)};
+    static constexpr HandleField errorInformationHandle{
+        "Memory Error Information Handle", 0x06, specVersion(2, 1)};
+    static constexpr Field<uint16_t> totalWidth{"Total Width", 0x08,
+                                                specVersion(2, 1)};
+    static constexpr Field<uint16_t> dataWidth{"Data Width", 0x0a,
+                                               specVersion(2, 1)};
+    static constexpr Field<uint16_t> size{"Size", 0x0c, specVersion(2, 1)};
+    static constexpr Field<uint8_t> formFactor{"Form Factor", 0x0e,
+                                               specVersion(2, 1)};
+    static constexpr Field<uint8_t> deviceSet{"Device Set", 0x0f,
+                                              specVersion(2, 1)};
+    static constexpr StringField deviceLocator{"Device Locator", 0x10,
+                                               specVersion(2, 1)};
+    static constexpr StringField bankLocator{"Bank Locator", 0x11,
+                                             specVersion(2, 1)};
+    static constexpr Field<uint8_t> memoryType{"Memory Type", 0x12,
+                                               specVersion(2, 1)};
+    static constexpr Field<uint16_t> typeDetail{"Type Detail", 0x13,
+                                                specVersion(2, 1)};
+    static constexpr Field<uint16_t> speed{"Speed", 0x15, specVersion(2, 3)};
+    static constexpr StringField manufacturer{"Manufacturer", 0x17,
+                                              specVersion(2, 3)};
+    static constexpr StringField serialNumber{"Serial Number", 0x18,
+                                              specVersion(2, 3)};
+    static constexpr StringField assetTag{"Asset Tag", 0x19,
+                                          specVersion(2, 3)};
+    static constexpr StringField partNumber{"Part Number", 0x1a,
+                                            specVersion(2, 3)};
+    static constexpr Field<uint8_t> attributes{"Attributes", 0x1b,
+                                               specVersion(2, 6)};
+    static constexpr Field<uint32_t> extendedSize{"Extended Size", 0x1c,
+                                                  specVersion(2, 7)};
+    static constexpr Field<uint16_t, FieldKind::number, uint32_t>
+        configuredSpeed{"Configured Memory Speed", 0x20, specVersion(2, 7)};
+    static constexpr Field<uint16_t> minimumVoltage{"Minimum voltage", 0x22,
+                                                    specVersion(2, 8)};
+    static constexpr Field<uint16_t> maximumVoltage{"Maximum voltage", 0x24,
+                                                    specVersion(2, 8)};
+    static constexpr Field<uint16_t> configuredVoltage{
+        "Configured voltage", 0x26, specVersion(2, 8)};
+    static constexpr Field<uint8_t> memoryTechnology{"Memory Technology",
+                                                     0x28, specVersion(3, 2)};
+    static constexpr Field<uint16_t> operatingModeCapability{
+        "Memory Operating Mode Capabilty", 0x29, specVersion(3, 2)};
+    // Published as the string number, as it always has been.
+    static constexpr Field<uint8_t> firmwareVersion{"Firmare Version", 0x2b,
+                                                    specVersion(3, 2)};
+    static constexpr Field<uint16_t> moduleManufacturerId{
+        "Module Manufacturer ID", 0x2c, specVersion(3, 2)};
+    static constexpr Field<uint16_t> moduleProductId{"Module Product ID", 0x2e,
+                                                     specVersion(3, 2)};
+    static constexpr Field<uint16_t> controllerManufacturerId{
+        "Memory Subsystem Controller Manufacturer ID", 0x30,
+        specVersion(3, 2)};
+    static constexpr Field<uint16_t> controllerProductId{
+        "Memory Subsystem Controller Product Id", 0x32, specVersion(3, 2)};
+    static constexpr Field<uint64_t> nonVolatileSize{"Non-volatile Size",
+                                                     0x34, specVersion(3, 2)};
+    static constexpr Field<uint64_t> volatileSize{"Volatile Size", 0x3c,
+                                                  specVersion(3, 2)};
+    static constexpr Field<uint64_t> cacheSize{"Cache Size", 0x44,
+                                               specVersion(3, 2)};
+    static constexpr Field<uint64_t> logicalSize{"Logical Size", 0x4c,
+                                                 specVersion(3, 2)};
+
+    static constexpr auto all = std::make_tuple(
+        type, length, handle, arrayHandle, errorInformationHandle, totalWidth,
+        dataWidth, size, formFactor, deviceSet, deviceLocator, bankLocator,
+        memoryType, typeDetail, speed, manufacturer, serialNumber, assetTag,
+        partNumber, attributes, extendedSize, configuredSpeed, minimumVoltage,
+        maximumVoltage, configuredVoltage, memoryTechnology,
+        operatingModeCapability, firmwareVersion, moduleManufacturerId,
+        moduleProductId, controllerManufacturerId, controllerProductId,
+        nonVolatileSize, volatileSize, cacheSize, logicalSize);
+};
+
+struct MemoryArrayMappedAddressFields
+{
+    static constexpr Field<uint8_t> type{"Type", 0x00, specVersion(2, 0)};
+    static constexpr Field<uint8_t> length{"Length", 0x01, specVersion(2, 0)};
+    static constexpr HandleField handle{"Handle", 0x02, specVersion(2, 0)};
+    static constexpr Field<uint32_t> startingAddress{"Starting Address", 0x04,
+                                                     specVersion(2, 1)};
+    static constexpr Field<uint32_t> endingAddress{"Ending Address", 0x08,
+                                                   specVersion(2, 1)};
+    static constexpr HandleField arrayHandle{"Memory Array Handle", 0x0c,
+                                             specVersion(2, 1)};
+    static constexpr Field<uint8_t> partitionWidth{"Partition Width", 0x0e,
+                                                   specVersion(2, 1)};
+    static constexpr Field<uint64_t> extendedStartingAddress{
+        "Extended Starting Address", 0x0f, specVersion(2, 7)};
+    static constexpr Field<uint64_t> extendedEndingAddress{
+        "Extended Ending Address", 0x17, specVersion(2, 7)};
+
+    static constexpr auto all = std::make_tuple(
+        type, length, handle, startingAddress, endingAddress, arrayHandle,
+        partitionWidth, extendedStartingAddress, extendedEndingAddress);
+};
+
+/**
+ * @brief Call visitor with the descriptor tuple of a structure type.
+ *
+ * @return false, without calling visitor, if no descriptors exist for the
+ *         type.
+ */
+template <typename Visitor>
+bool visitTypeFields(uint8_t type, Visitor&& visitor)
+{
+    switch (type)
+    {
+        case biosType:
+            visitor(BiosFields::all);
+            return true;
+        case systemType:
+            visitor(SystemFields::all);
+            return true;
+        case baseboardType:
+            visitor(BaseboardFields::all);
+            return true;
+        case chassisType:
+            visitor(ChassisFields::all);
+            return true;
+        case processorsType:
+            visitor(ProcessorFields::all);
+            return true;
+        case cacheType:
+            visitor(CacheFields::all);
+            return true;
+        case systemSlots:
+            visitor(SystemSlotFields::all);
+            return true;
+        case physicalMemoryArrayType:
+            visitor(PhysicalMemoryArrayFields::all);
+            return true;
+        case memoryDeviceType:
+            visitor(MemoryDeviceFields::all);
+            return true;
+        case memoryArrayMappedAddressType:
+            visitor(MemoryArrayMappedAddressFields::all);
+            return true;
+        default:
+            return false;
+    }
+}
+
+static_assert(lengthThrough(BiosFields::all, specVersion(2, 0)) == 0x12);
+static_assert(lengthThrough(SystemFields::all, specVersion(2, 4)) == 0x1b);
+static_assert(lengthThrough(BaseboardFields::all, specVersion(2, 0)) == 0x0f);
+static_assert(lengthThrough(ChassisFields::all, specVersion(2, 3)) == 0x15);
+static_assert(lengthThrough(ProcessorFields::all, specVersion(3, 0)) == 0x30);
+static_assert(lengthCovering(ProcessorFields::socket,
+                             ProcessorFields::threadCount) == 0x26);
+static_assert(lengthThrough(CacheFields::all, specVersion(3, 1)) == 0x1b);
+static_assert(lengthThrough(SystemSlotFields::all, specVersion(2, 6)) == 0x11);
+static_assert(lengthThrough(PhysicalMemoryArrayFields::all,
+                            specVersion(2, 7)) == 0x17);
+static_assert(lengthThrough(MemoryDeviceFields::all, specVersion(3, 2)) ==
+              0x54);
+static_assert(lengthThrough(MemoryArrayMappedAddressFields::all,
+                            specVersion(2, 7)) == 0x1f);
+
+} // namespace smbios
+
+} // namespace phosphor
@@ -0,0 +1,63 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <string>
+
+namespace phosphor
+{
+
+namespace smbios
+{
+
+/* SHA-256 digest of a structure table. */
+using TableHash = std::array<uint8_t, 32>;
+
+/** @brief SHA-256 of [data, data + size). */
+TableHash sha256(const uint8_t* data, size_t size);
+
+/** @brief The digest as 64 lowercase hex digits. */
+std::string toHex(const TableHash& hash);
+
+/**
+ * @brief Hash the structure table described by the entry point in the
+ * region data, as uploaded by the host or stored in the table file.
+ *
+ * Only the table is hashed, so uploads that differ just in the entry
+ * point or in padding hash the same.
+ *
+ * @return The hash, or std::nullopt if there is no valid entry point.
+ */
+std::optional<TableHash> hashRegionTable(const uint8_t* region, size_t size);
+
+/**
+ * @brief Record hash as the hash of the table in use.
+ *
+ * Written to a temporary file renamed over hashFile, so a reader never
+ * sees half a hash.
+ */
+bool storeTableHash(const char* hashFile, const TableHash& hash);
+
+/**
+ * @brief Whether hash names the table the daemon is using.
+ *
+ * Only while tableFile exists and hashFile holds hash. A table file
+ * removed without its hash is not in use, whatever the hash says.
+ */
+bool tableFileInUse(const char* tableFile, const char* hashFile,
+                    const TableHash& hash);
+
+/**
+ * @brief Remove a table file together with its stored hash.
+ *
+ * The hash goes first, so it never outlives the table it describes.
+ *
+ * @return false if either file exists and could not be removed.
+ */
+bool removeTableFile(const char* tableFile, const char* hashFile);
+
+} // namespace smbios
+
+} // namespace phosphor
@@ -0,0 +1,120 @@
+#pragma once
+
+#include "smbios_table.hpp"
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <ranges>
+#include <unordered_map>
+#include <vector>
+
+namespace phosphor
+{
+
+namespace smbios
+{
+
+/**
+ * @brief Offsets of the structures in an SMBIOS table, built in one pass.
+ *
+ * The table is walked once when it is loaded. Inventory objects then look
+ * up the Nth structure of a type, or the structure a handle refers to,
+ * directly instead of rescanning the table from the start.
+ */
+class SmbiosIndex
+{
+  public:
+    SmbiosIndex() = default;
+    ~SmbiosIndex() = default;
+    SmbiosIndex(const SmbiosIndex&) = delete;
+    SmbiosIndex& operator=(const SmbiosIndex&) = delete;
+    SmbiosIndex(SmbiosIndex&&) = default;
+    SmbiosIndex& operator=(SmbiosIndex&&) = default;
+
+    /** @brief Walk the verified table once and record every structure.
+     *
+     *  @param[in] verified - Table that passed VerifiedTable::verify()
+     */
+    void build(const VerifiedTable& verified);
+
+    /** @brief Forget the table and all recorded offsets. */
+    void clear()
+    {
+        table = nullptr;
+        structureOffsets.clear();
+        handleOffsets.clear();
+        for (auto& offsets : typeOffsets)
+        {
+            offsets.clear();
+        }
+    }
+
+    /** @brief Number of structures of the given type. */
+    size_t count(uint8_t type) const
+    {
+        return typeOffsets[type].size();
+    }
+
+    /** @brief Pointer to the Nth structure of the given type, or nullptr. */
+    uint8_t* get(uint8_t type, size_t index) const
+    {
+        const std::vector<uint32_t>& offsets = typeOffsets[type];
+        if (table == nullptr || index >= offsets.size())
+        {
+            return nullptr;
+        }
+        return table + offsets[index];
+    }
+
+    /** @brief Pointer to the structure with the given handle, or nullptr. */
+    uint8_t* getByHandle(uint16_t handle) const
+    {
+        auto it = handleOffsets.find(handle);
+        if (table == nullptr || it == handleOffsets.end())
+        {
+            return nullptr;
+        }
+        return table + it->second;
+    }
+
+    /** @brief Structures of the given type, in table order. */
+    auto structures(uint8_t type) const
+    {
+        return typeOffsets[type] |
+               std::views::transform([table = table](uint32_t offset) {
+                   return Structure(table + offset);
+               });
+    }
+
+    /** @brief Offsets of every structure, in table order. */
+    const std::vector<uint32_t>& offsets() const
+    {
+        return structureOffsets;
+    }
+
+    /** @brief Offsets of the structures of the given type, in table order. */
+    const std::vector<uint32_t>& offsets(uint8_t type) const
+    {
+        return typeOffsets[type];
+    }
+
+    /** @brief Start of the indexed table. */
+    uint8_t* data() const
+    {
+        return table;
+    }
+
+  private:
+    uint8_t* table = nullptr;
+
+    std::vector<uint32_t> structureOffsets;
+
+    std::array<std::vector<uint32_t>, 256> typeOffsets;
+
+    std::unordered_map<uint16_t, uint32_t> handleOffsets;
+};
+
+} // namespace smbios
+
+} // namespace phosphor
@@ -0,0 +1,232 @@
+#pragma once
+
+#include "smbios_scan.hpp"
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+
+/* SMBIOS table layout and the primitives every parser component builds on.
+ * Nothing here depends on D-Bus or on the MDR version a daemon speaks, so
+ * the parser library and offline tools can use it as well as the daemons.
+ */
+
+typedef struct
+{
+    uint8_t majorVersion;
+    uint8_t minorVersion;
+} SMBIOSVersion;
+
+struct EntryPointStructure21
+{
+    uint32_t anchorString;
+    uint8_t epChecksum;
+    uint8_t epLength;
+    SMBIOSVersion smbiosVersion;
+    uint16_t maxStructSize;
+    uint8_t epRevision;
+    uint8_t formattedArea[5];
+    uint8_t intermediateAnchorString[5];
+    uint8_t intermediateChecksum;
+    uint16_t structTableLength;
+    uint32_t structTableAddress;
+    uint16_t noOfSmbiosStruct;
+    uint8_t smbiosBDCRevision;
+} __attribute__((packed));
+
+struct EntryPointStructure30
+{
+    uint8_t anchorString[5];
+    uint8_t epChecksum;
+    uint8_t epLength;
+    SMBIOSVersion smbiosVersion;
+    uint8_t smbiosDocRev;
+    uint8_t epRevision;
+    uint8_t reserved;
+    uint32_t structTableMaxSize;
+    uint64_t structTableAddr;
+} __attribute__((packed));
+
+/* Header in front of the region data in the files the MDRv2 daemon and
+ * the IPMI blob handler store, such as /var/lib/smbios/smbios2.
+ */
+struct MDRSMBIOSHeader
+{
+    uint8_t dirVer;
+    uint8_t mdrType;
+    uint32_t timestamp;
+    uint32_t dataSize;
+} __attribute__((packed));
+
+constexpr uint8_t mdrTypeII = 2;
+
+/* Host address the MDRv2 region data was copied from. */
+constexpr uint32_t mdr2SMBaseAddress = 0x9FF00000;
+
+constexpr std::array<SMBIOSVersion, 3> supportedSMBIOSVersions{
+    SMBIOSVersion{3, 2}, SMBIOSVersion{3, 3}, SMBIOSVersion{3, 5}};
+
+/** @brief Whether the daemons decode tables of this SMBIOS version. */
+bool isSupportedSMBIOSVersion(const SMBIOSVersion& version);
+
+typedef enum
+{
+    biosType = 0,
+    systemType = 1,
+    baseboardType = 2,
+    chassisType = 3,
+    processorsType = 4,
+    memoryControllerType = 5,
+    memoryModuleInformationType = 6,
+    cacheType = 7,
+    portConnectorType = 8,
+    systemSlots = 9,
+    onBoardDevicesType = 10,
+    oemStringsType = 11,
+    systemCconfigurationOptionsType = 12,
+    biosLanguageType = 13,
+    groupAssociatonsType = 14,
+    systemEventLogType = 15,
+    physicalMemoryArrayType = 16,
+    memoryDeviceType = 17,
+    memoryErrorInformationType = 18,
+    memoryArrayMappedAddressType = 19,
+} SmbiosType;
+
+static constexpr uint8_t separateLen = 2;
+static constexpr uint8_t structureHeaderLen = 4;
+
+/**
+ * @brief Step to the structure that follows smbiosDataIn.
+ *
+ * Every read stays inside [smbiosDataIn, end), so the walk is bounded by
+ * the real end of the table rather than by a byte counter.
+ *
+ * @param[in] smbiosDataIn - Start of the current structure
+ * @param[in] end          - One past the last byte of the table
+ *
+ * @return Start of the next structure, or nullptr if the current one is
+ *         malformed or runs past end.
+ */
+static inline uint8_t* smbiosNextPtr(uint8_t* smbiosDataIn,
+                                     const uint8_t* end)
+{
+    if (smbiosDataIn == nullptr || end - smbiosDataIn < structureHeaderLen)
+    {
+        return nullptr;
+    }
+    uint8_t len = *(smbiosDataIn + 1);
+    if (len < structureHeaderLen || end - smbiosDataIn < len + separateLen)
+    {
+        return nullptr;
+    }
+    uint8_t* smbiosData = smbiosDataIn + len;
+    // Candidate offsets for the first NUL of the terminator; the scan reads
+    // at most one byte past the last candidate, which is end - 1.
+    size_t count = static_cast<size_t>(end - smbiosData) - 1;
+    size_t offset = phosphor::smbios::findStringSetEnd(smbiosData, count);
+    if (offset >= count)
+    {
+        return nullptr;
+    }
+    return smbiosData + offset + separateLen;
+}
+
+/**
+ * @brief Find the next structure of typeId at or after smbiosDataIn.
+ *
+ * The first call passes the start of the table; later calls pass the
+ * structure after the previous match to continue the walk.
+ *
+ * @param[in] smbiosDataIn - Structure to start the search at
+ * @param[in] typeId       - Structure type to look for
+ * @param[in] end          - One past the last byte of the table
+ * @param[in] size         - Minimum length of the formatted area
+ *
+ * @return The matching structure, or nullptr if there is none, if the walk
+ *         meets a malformed structure first, or if the match is shorter
+ *         than size.
+ */
+uint8_t* getSMBIOSTypePtr(uint8_t* smbiosDataIn, uint8_t typeId,
+                          const uint8_t* end, size_t size = 0);
+
+/**
+ * @brief Copy the string at the 1-based positionNum of a structure.
+ *
+ * Finds the end of the string set with findStringSetEnd on every call;
+ * SmbiosStrings indexes it once.
+ *
+ * @param[in] positionNum - 1-based string number
+ * @param[in] structLen   - Length of the formatted area
+ * @param[in] dataIn      - Start of the structure
+ * @param[in] end         - One past the last byte of the table
+ *
+ * @return The string, or an empty string if positionNum is 0, past the end
+ *         of the set, or the set is not terminated before end.
+ */
+std::string positionToString(uint8_t positionNum, uint8_t structLen,
+                             uint8_t* dataIn, const uint8_t* end);
+
+/**
+ * @brief Zero-copy view of the string set of one SMBIOS structure.
+ *
+ * The string set is walked once on construction. Each lookup afterwards
+ * returns a view into the table storage in constant time, so the caller
+ * only copies when a value crosses the D-Bus boundary.
+ *
+ * dataIn must point at a structure whose string set is terminated inside
+ * the table, such as one returned by SmbiosIndex or getSMBIOSTypePtr.
+ */
+class SmbiosStrings
+{
+  public:
+    SmbiosStrings() = delete;
+
+    explicit SmbiosStrings(const uint8_t* dataIn)
+    {
+        if (dataIn == nullptr)
+        {
+            return;
+        }
+        base = reinterpret_cast<const char*>(dataIn + *(dataIn + 1));
+
+        const char* target = base;
+        // 0x00 0x00 means end of the entry.
+        while (*target != '\0' && count < maxStrings)
+        {
+            const char* start = target;
+            target += std::char_traits<char>::length(target) + 1;
+            starts[count++] = static_cast<uint32_t>(start - base);
+            starts[count] = static_cast<uint32_t>(target - base);
+        }
+    }
+
+    /** @brief String at the 1-based position, or empty if not present. */
+    std::string_view operator[](uint8_t positionNum) const
+    {
+        if (positionNum == 0 || positionNum > count)
+        {
+            return {};
+        }
+        uint32_t start = starts[positionNum - 1];
+        // The next start is one past the NUL ending this string.
+        return {base + start, starts[positionNum] - start - 1};
+    }
+
+    /** @brief Number of strings in the set. */
+    size_t size() const
+    {
+        return count;
+    }
+
+  private:
+    static constexpr size_t maxStrings = 0xff;
+
+    const char* base = nullptr;
+
+    size_t count = 0;
+
+    std::array<uint32_t, maxStrings + 1> starts{};
+};
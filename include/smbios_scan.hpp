@@ -0,0 +1,112 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#elif defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+namespace phosphor
+{
+
+namespace smbios
+{
+
+namespace internal
+{
+
+#if defined(__AVX2__)
+
+static constexpr size_t scanWidth = 32;
+
+__attribute__((no_sanitize_address)) static inline uint64_t
+    zeroMask(const uint8_t* block)
+{
+    __m256i data = _mm256_load_si256(reinterpret_cast<const __m256i*>(block));
+    return static_cast<uint32_t>(
+        _mm256_movemask_epi8(_mm256_cmpeq_epi8(data, _mm256_setzero_si256())));
+}
+
+#elif defined(__SSE2__)
+
+static constexpr size_t scanWidth = 16;
+
+__attribute__((no_sanitize_address)) static inline uint64_t
+    zeroMask(const uint8_t* block)
+{
+    __m128i data = _mm_load_si128(reinterpret_cast<const __m128i*>(block));
+    return static_cast<uint32_t>(
+        _mm_movemask_epi8(_mm_cmpeq_epi8(data, _mm_setzero_si128())));
+}
+
+#endif
+
+} // namespace internal
+
+/**
+ * @brief Find the double-NUL that terminates a structure's string set.
+ *
+ * Checks 32 (AVX2) or 16 (SSE2) bytes per step for NUL bytes and only
+ * inspects the following byte for those candidates. Other builds, ARM
+ * included, use a byte loop.
+ *
+ * Vector loads are aligned to their width so a load never crosses a page
+ * boundary, even though it may touch bytes outside [data, data + count].
+ *
+ * @param[in] data  - Start of the string set
+ * @param[in] count - Number of candidate offsets to check; at most
+ *                    count + 1 bytes are examined
+ *
+ * @return Offset of the first NUL of the terminator, or count if there is
+ *         none in range.
+ */
+static inline size_t findStringSetEnd(const uint8_t* data, size_t count)
+{
+#if defined(__AVX2__) || defined(__SSE2__)
+    using namespace internal;
+
+    const uint8_t* end = data + count;
+    size_t misalign = reinterpret_cast<uintptr_t>(data) & (scanWidth - 1);
+    const uint8_t* block = data - misalign;
+    uint64_t mask = zeroMask(block) & (~0ULL << misalign);
+
+    while (true)
+    {
+        while (mask != 0)
+        {
+            const uint8_t* pos = block + __builtin_ctzll(mask);
+            if (pos >= end)
+            {
+                return count;
+            }
+            if (*(pos + 1) == '\0')
+            {
+                return static_cast<size_t>(pos - data);
+            }
+            mask &= mask - 1;
+        }
+        block += scanWidth;
+        if (block >= end)
+        {
+            return count;
+        }
+        mask = zeroMask(block);
+    }
+#else
+    for (size_t offset = 0; offset < count; offset++)
+    {
+        if ((data[offset] | data[offset + 1]) == 0)
+        {
+            return offset;
+        }
+    }
+    return count;
+#endif
+}
+
+} // namespace smbios
+
+} // namespace phosphor
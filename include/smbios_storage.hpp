@@ -0,0 +1,147 @@
+#pragma once
+
+#include "smbios_parse.hpp"
+
+#include <sys/stat.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <span>
+
+namespace phosphor
+{
+
+namespace smbios
+{
+
+/* Why TableFile::load() failed. */
+enum class LoadError
+{
+    /* The file is missing or unreadable. */
+    open,
+    /* The file is shorter than an MDRSMBIOSHeader. */
+    tooSmall,
+    /* The header claims more data than the caller accepts. */
+    tooLarge,
+    /* fstat(), reading the file or allocating its copy failed. */
+    read,
+};
+
+/**
+ * @brief A private, read-only copy of the table file written by
+ * SmbiosBlobHandler.
+ *
+ * load() checks the MDRSMBIOSHeader and reads the header and the region
+ * data it claims into anonymous memory, which is then made read-only. The
+ * file itself is never mapped: other writers, such as the MDR V2 IPMI
+ * commands, rewrite it in place, and a truncated file mapping would fault
+ * on the next read. Changes to the file after load() are not seen.
+ */
+class TableFile
+{
+  public:
+    TableFile() = default;
+    ~TableFile();
+    TableFile(const TableFile&) = delete;
+    TableFile& operator=(const TableFile&) = delete;
+    TableFile(TableFile&& other) noexcept;
+    TableFile& operator=(TableFile&& other) noexcept;
+
+    /** @brief Copy the file at path.
+     *
+     *  @param[in] path        - Table file
+     *  @param[in] maxDataSize - Largest dataSize accepted in the header
+     *  @param[out] error      - Set to the reason for failure, if given
+     *
+     *  @return The copy, or std::nullopt. The data is cut short if the
+     *          file holds less than the header claims.
+     */
+    static std::optional<TableFile> load(const char* path, size_t maxDataSize,
+                                         LoadError* error = nullptr);
+
+    bool mapped() const
+    {
+        return base != nullptr;
+    }
+
+    const MDRSMBIOSHeader& header() const
+    {
+        return *reinterpret_cast<const MDRSMBIOSHeader*>(base);
+    }
+
+    /** @brief The region data after the header. Must not be written. */
+    std::span<uint8_t> data() const
+    {
+        if (base == nullptr)
+        {
+            return {};
+        }
+        return {base + sizeof(MDRSMBIOSHeader), dataSize};
+    }
+
+    /** @brief What fstat() reported for the file when it was copied. */
+    const struct stat& status() const
+    {
+        return fileStatus;
+    }
+
+  private:
+    void unmap();
+
+    uint8_t* base = nullptr;
+    size_t mappedSize = 0;
+    size_t dataSize = 0;
+    struct stat fileStatus = {};
+};
+
+/* Start of a table exported by SealedTable, the table follows it. */
+struct RawTableHeader
+{
+    /* Counts the tables the daemon has accepted since it started. */
+    uint64_t generation;
+    /* Offset of the table from the start of the file, and its size. */
+    uint32_t tableOffset;
+    uint32_t tableSize;
+};
+
+/**
+ * @brief A structure table copied into a sealed memfd, to be handed to
+ * other processes as a file descriptor.
+ *
+ * The memfd holds a RawTableHeader followed by the table and is sealed
+ * against writing, growing and shrinking before anyone sees it, so every
+ * reader can map it and read a whole, unchanging table.
+ */
+class SealedTable
+{
+  public:
+    SealedTable() = default;
+    ~SealedTable();
+    SealedTable(const SealedTable&) = delete;
+    SealedTable& operator=(const SealedTable&) = delete;
+    SealedTable(SealedTable&& other) noexcept;
+    SealedTable& operator=(SealedTable&& other) noexcept;
+
+    /** @brief Copy [table, table + size) into a new sealed memfd.
+     *
+     *  @return The memfd, or std::nullopt, with errno set, if it could not
+     *          be created, written or sealed.
+     */
+    static std::optional<SealedTable> create(uint64_t generation,
+                                             const uint8_t* table,
+                                             size_t size);
+
+    /** @brief The memfd, owned by this object. */
+    int fd() const
+    {
+        return memfd;
+    }
+
+  private:
+    int memfd = -1;
+};
+
+} // namespace smbios
+
+} // namespace phosphor
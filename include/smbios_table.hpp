@@ -0,0 +1,255 @@
+#pragma once
+
+#include "smbios_parse.hpp"
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <optional>
+#include <ranges>
+
+namespace phosphor
+{
+
+namespace smbios
+{
+
+/**
+ * @brief View of one structure in an SMBIOS table.
+ *
+ * Structures handed out by Table and SmbiosIndex always end inside the
+ * table, so the formatted area and the string set can be read directly.
+ */
+class Structure
+{
+  public:
+    Structure() = default;
+
+    explicit Structure(uint8_t* dataIn) : dataIn(dataIn)
+    {}
+
+    uint8_t type() const
+    {
+        return *dataIn;
+    }
+
+    uint8_t length() const
+    {
+        return *(dataIn + 1);
+    }
+
+    uint16_t handle() const
+    {
+        return static_cast<uint16_t>(*(dataIn + 2) | (*(dataIn + 3) << 8));
+    }
+
+    uint8_t* data() const
+    {
+        return dataIn;
+    }
+
+    SmbiosStrings strings() const
+    {
+        return SmbiosStrings(dataIn);
+    }
+
+    /** @brief The formatted area as Info, or nullptr if it is too short. */
+    template <typename Info>
+    const Info* as() const
+    {
+        if (length() < sizeof(Info))
+        {
+            return nullptr;
+        }
+        return reinterpret_cast<const Info*>(dataIn);
+    }
+
+  private:
+    uint8_t* dataIn = nullptr;
+};
+
+/* Forward iterator over the structures of a Table. */
+class StructureIterator
+{
+  public:
+    using iterator_concept = std::forward_iterator_tag;
+    using iterator_category = std::forward_iterator_tag;
+    using value_type = Structure;
+    using difference_type = std::ptrdiff_t;
+    using reference = Structure;
+    using pointer = void;
+
+    StructureIterator() = default;
+
+    StructureIterator(uint8_t* dataIn, const uint8_t* end) :
+        current(dataIn), end(end)
+    {
+        settle();
+    }
+
+    Structure operator*() const
+    {
+        return Structure(current);
+    }
+
+    StructureIterator& operator++()
+    {
+        current = next;
+        settle();
+        return *this;
+    }
+
+    StructureIterator operator++(int)
+    {
+        StructureIterator previous = *this;
+        ++*this;
+        return previous;
+    }
+
+    bool operator==(const StructureIterator& other) const
+    {
+        return current == other.current;
+    }
+
+  private:
+    /* Stop unless the current structure ends inside the table. */
+    void settle()
+    {
+        if (current == nullptr || end - current < separateLen ||
+            ((*current == '\0') && (*(current + 1) == '\0')))
+        {
+            current = nullptr;
+            return;
+        }
+        next = smbiosNextPtr(current, end);
+        if (next == nullptr)
+        {
+            current = nullptr;
+        }
+    }
+
+    uint8_t* current = nullptr;
+    uint8_t* next = nullptr;
+    const uint8_t* end = nullptr;
+};
+
+/**
+ * @brief An SMBIOS structure table in [begin, begin + size).
+ *
+ * structures() is a lazy forward range: each step finds the next structure
+ * with smbiosNextPtr, so a filtered walk visits the table once. The walk
+ * ends at a double-NUL, at the end of the span, or at the first structure
+ * that does not end inside the span.
+ */
+class Table
+{
+  public:
+    using iterator = StructureIterator;
+
+    Table() = default;
+
+    Table(uint8_t* begin, size_t size) : begin(begin), size(size)
+    {}
+
+    std::ranges::subrange<iterator> structures() const
+    {
+        if (begin == nullptr)
+        {
+            return {};
+        }
+        return {iterator(begin, begin + size), iterator()};
+    }
+
+  private:
+    uint8_t* begin = nullptr;
+    size_t size = 0;
+};
+
+/* Shortest formatted area accepted for each structure type. */
+using LengthRequirements = std::array<uint8_t, 256>;
+
+static constexpr uint8_t endOfTableType = 127;
+
+/* Where and why VerifiedTable::verify() rejected a table. */
+struct VerifyError
+{
+    enum class Reason
+    {
+        /* A header or string set runs past the end of the table. */
+        malformed,
+        /* A structure is shorter than its type requires. */
+        tooShort,
+    };
+
+    Reason reason;
+    /* Offset of the rejected structure from the start of the table. */
+    size_t offset;
+    uint8_t type;
+    uint8_t length;
+};
+
+/**
+ * @brief A structure table that passed validation once, on load.
+ *
+ * Only verify() creates one. It walks the table a single time and checks
+ * every structure header, that every string set ends inside the table and
+ * that the types the inventory reads are long enough for the fields it
+ * reads. Code holding a VerifiedTable, and the SmbiosIndex built from it,
+ * can read those structures without checking again.
+ *
+ * The table ends after the end-of-table structure (type 127), at a
+ * double-NUL, or at the end of the data.
+ */
+class VerifiedTable
+{
+  public:
+    /** @brief Validate [begin, begin + size).
+     *
+     *  @param[in] begin    - Start of the structure table
+     *  @param[in] size     - Size of the data holding the table
+     *  @param[in] required - Minimum length of each structure type
+     *  @param[out] error   - Set to the rejected structure, if given
+     *
+     *  @return The verified table, or std::nullopt if any structure is
+     *          malformed.
+     */
+    static std::optional<VerifiedTable>
+        verify(uint8_t* begin, size_t size, const LengthRequirements& required,
+               VerifyError* error = nullptr);
+
+    Table table() const
+    {
+        return Table(begin, length);
+    }
+
+    uint8_t* data() const
+    {
+        return begin;
+    }
+
+    /** @brief Bytes from the first structure to the end of the last one. */
+    size_t size() const
+    {
+        return length;
+    }
+
+  private:
+    VerifiedTable(uint8_t* begin, size_t length) : begin(begin), length(length)
+    {}
+
+    uint8_t* begin;
+    size_t length;
+};
+
+/** @brief Predicate selecting structures of one type. */
+static inline auto byType(uint8_t type)
+{
+    return [type](const Structure& structure) {
+        return structure.type() == type;
+    };
+}
+
+} // namespace smbios
+
+} // namespace phosphor
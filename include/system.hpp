@@ -16,6 +16,7 @@
 
 #pragma once
 #include "smbios.hpp"
+#include "smbios_index.hpp"
 
 #include <xyz/openbmc_project/Common/UUID/server.hpp>
 #include <xyz/openbmc_project/Inventory/Decorator/Revision/server.hpp>
@@ -26,11 +27,11 @@ namespace phosphor
 namespace smbios
 {
 
-class System :
-    sdbusplus::server::object_t<
-        sdbusplus::xyz::openbmc_project::Common::server::UUID>,
-    sdbusplus::server::object_t<
-        sdbusplus::xyz::openbmc_project::Inventory::Decorator::server::Revision>
+using SystemObject = sdbusplus::server::object_t<
+    sdbusplus::xyz::openbmc_project::Common::server::UUID,
+    sdbusplus::xyz::openbmc_project::Inventory::Decorator::server::Revision>;
+
+class System : SystemObject
 {
   public:
     System() = delete;
@@ -41,15 +42,17 @@ class System :
     System& operator=(System&&) = default;
 
     System(sdbusplus::bus_t& bus, const std::string& objPath,
-           uint8_t* smbiosTableStorage) :
-        sdbusplus::server::object_t<
-            sdbusplus::xyz::openbmc_project::Common::server::UUID>(
-            bus, objPath.c_str()),
-        bus(bus),
-        sdbusplus::server::object_t<sdbusplus::xyz::openbmc_project::Inventory::
-                                        Decorator::server::Revision>(
-            bus, objPath.c_str()),
-        path(objPath), storage(smbiosTableStorage)
+           const SmbiosIndex& index) :
+        SystemObject(bus, objPath.c_str(), SystemObject::action::defer_emit),
+        bus(bus), path(objPath), smbiosIndex(index)
+    {
+        refresh();
+        skipSignal = false;
+        emit_object_added();
+    }
+
+    /** @brief Re-read the UUID and BIOS version from the table. */
+    void refresh()
     {
         std::string input = "0";
         uuid(input);
@@ -65,7 +68,10 @@ class System :
     /** @brief Path of the group instance */
     std::string path;
 
-    uint8_t* storage;
+    const SmbiosIndex& smbiosIndex;
+
+    /* Set until the populated object is announced with InterfacesAdded. */
+    bool skipSignal = true;
 
     struct BIOSInfo
     {
@@ -15,9 +15,6 @@
 */
 
 #include "cpu.hpp"
-#ifdef SMBIOS_MDRV1
-#include "mdrv1.hpp"
-#endif
 
 #include <bitset>
 #include <map>
@@ -27,106 +24,83 @@ namespace phosphor
 namespace smbios
 {
 
-void Cpu::socket(const uint8_t positionNum, const uint8_t structLen,
-                 uint8_t* dataIn)
+template <typename Policy>
+void Cpu<Policy>::socket(std::string_view value)
 {
-    std::string result = positionToString(positionNum, structLen, dataIn);
+    std::string result(value);
 
-    processor::socket(result);
-    location::locationCode(result);
+    processor::socket(result, skipSignal);
+    location::locationCode(result, skipSignal);
 }
 
 static constexpr uint8_t processorFamily2Indicator = 0xfe;
-void Cpu::family(const uint8_t family
-#ifdef SMBIOS_MDRV2
-				, const uint16_t family2
-#endif
-				 )
+template <typename Policy>
+void Cpu<Policy>::family(const uint8_t family, const uint16_t family2)
 {
     std::map<uint8_t, const char*>::const_iterator it =
         familyTable.find(family);
     if (it == familyTable.end())
     {
-    	processor::family("Unknown Processor Family");
-    }
-#ifdef SMBIOS_MDRV2
-    else if (it->first == processorFamily2Indicator)
-    {
-        std::map<uint16_t, const char*>::const_iterator it2 =
-            family2Table.find(family2);
-        if (it2 == family2Table.end())
+        processor::family("Unknown Processor Family", skipSignal);
+        if constexpr (Policy::processorFamily2)
         {
-            processor::family("Unknown Processor Family");
+            processor::effectiveFamily(0, skipSignal);
         }
-        else
+        return;
+    }
+    if constexpr (Policy::processorFamily2)
+    {
+        if (it->first == processorFamily2Indicator)
         {
-            processor::family(it2->second);
-            processor::effectiveFamily(family2);
+            std::map<uint16_t, const char*>::const_iterator it2 =
+                family2Table.find(family2);
+            if (it2 == family2Table.end())
+            {
+                processor::family("Unknown Processor Family", skipSignal);
+                processor::effectiveFamily(0, skipSignal);
+            }
+            else
+            {
+                processor::family(it2->second, skipSignal);
+                processor::effectiveFamily(family2, skipSignal);
+            }
+            return;
         }
     }
-#endif
-    else
+    processor::family(it->second, skipSignal);
+    if constexpr (Policy::processorFamily2)
     {
-    	processor::family(it->second);
-#ifdef SMBIOS_MDRV2
-        processor::effectiveFamily(family);
-#endif
+        processor::effectiveFamily(family, skipSignal);
     }
 }
 
-void Cpu::manufacturer(const uint8_t positionNum, const uint8_t structLen,
-                       uint8_t* dataIn)
+template <typename Policy>
+void Cpu<Policy>::manufacturer(std::string_view value)
 {
-    std::string result = positionToString(positionNum, structLen, dataIn);
-
-    asset::manufacturer(result);
+    asset::manufacturer(std::string(value), skipSignal);
 }
 
-#ifdef SMBIOS_MDRV2
-void Cpu::partNumber(const uint8_t positionNum, const uint8_t structLen,
-                     uint8_t* dataIn)
+template <typename Policy>
+void Cpu<Policy>::partNumber(std::string_view value)
 {
-    std::string result = positionToString(positionNum, structLen, dataIn);
-
-    asset::partNumber(result);
+    asset::partNumber(std::string(value), skipSignal);
 }
 
-void Cpu::serialNumber(const uint8_t positionNum, const uint8_t structLen,
-                       uint8_t* dataIn)
+template <typename Policy>
+void Cpu<Policy>::serialNumber(std::string_view value)
 {
-    std::string result = positionToString(positionNum, structLen, dataIn);
-
-    asset::serialNumber(result);
+    asset::serialNumber(std::string(value), skipSignal);
 }
-#endif
 
-void Cpu::version(const uint8_t positionNum, const uint8_t structLen,
-                  uint8_t* dataIn)
+template <typename Policy>
+void Cpu<Policy>::version(std::string_view value)
 {
-    std::string result;
-
-    result = positionToString(positionNum, structLen, dataIn);
-
-    rev::version(result);
+    rev::version(std::string(value), skipSignal);
 }
 
-void Cpu::characteristics(uint16_t value)
+template <typename Policy>
+void Cpu<Policy>::characteristics(uint16_t value)
 {
-#ifdef SMBIOS_MDRV1
-	/*
-    std::string result = "";
-    for (uint8_t index = 0; index < (8 * sizeof(value)); index++)
-    {
-        if (value & 0x01)
-        {
-            result += characterTable[index];
-        }
-        value >>= 1;
-    }
-
-    processor::characteristics(result);
-    */
-#elifdef SMBIOS_MDRV2
     std::vector<processor::Capability> result;
     std::optional<processor::Capability> cap;
 
@@ -142,97 +116,101 @@ void Cpu::characteristics(uint16_t value)
         }
     }
 
-    processor::characteristics(result);
-#endif
+    processor::characteristics(result, skipSignal);
 }
 
-static constexpr uint8_t maxOldVersionCount = 0xff;
-void Cpu::infoUpdate(void)
+template <typename Policy>
+void Cpu<Policy>::clearInfo(void)
 {
-#ifdef SMBIOS_MDRV1
-	uint8_t *dataIn = regionS[0].regionData;
-#elifdef SMBIOS_MDRV2
-    uint8_t* dataIn = storage;
-#endif
+    processor::family({}, skipSignal);
+    processor::effectiveFamily(0, skipSignal);
+    asset::manufacturer({}, skipSignal);
+    processor::id(0, skipSignal);
+    rev::version({}, skipSignal);
+    processor::maxSpeedInMhz(0, skipSignal);
+    asset::serialNumber({}, skipSignal);
+    asset::partNumber({}, skipSignal);
+    processor::coreCount(0, skipSignal);
+    processor::threadCount(0, skipSignal);
+    processor::characteristics({}, skipSignal);
+}
 
-    dataIn = getSMBIOSTypePtr(dataIn, processorsType);
-    if (dataIn == nullptr)
+static constexpr uint8_t maxOldVersionCount = 0xff;
+template <typename Policy>
+void Cpu<Policy>::infoUpdate(void)
+{
+    // Also cleared when the motherboard is not known (any more).
+    std::vector<std::tuple<std::string, std::string, std::string>> assocs;
+    if (!motherboardPath.empty())
     {
-        return;
+        assocs.emplace_back("chassis", "processors", motherboardPath);
     }
+    association::associations(assocs, skipSignal);
 
-    for (uint8_t index = 0; index < cpuNum; index++)
+    uint8_t* dataIn = smbiosIndex.get(processorsType, cpuNum);
+    if (dataIn == nullptr)
     {
-        dataIn = smbiosNextPtr(dataIn);
-        if (dataIn == nullptr)
-        {
-            return;
-        }
-        dataIn = getSMBIOSTypePtr(dataIn, processorsType);
-        if (dataIn == nullptr)
-        {
-            return;
-        }
+        // A refreshed object must not keep the previous table's values.
+        socket({});
+        present(false, skipSignal);
+        clearInfo();
+        return;
     }
 
     auto cpuInfo = reinterpret_cast<struct ProcessorInfo*>(dataIn);
+    SmbiosStrings strings(dataIn);
 
-    socket(cpuInfo->socketDesignation, cpuInfo->length, dataIn); // offset 4h
+    socket(strings[cpuInfo->socketDesignation]); // offset 4h
 
     constexpr uint32_t socketPopulatedMask = 1 << 6;
     if ((cpuInfo->status & socketPopulatedMask) == 0)
     {
         // Don't attempt to fill in any other details if the CPU is not present.
-        present(false);
+        present(false, skipSignal);
+        clearInfo();
         return;
     }
-    present(true);
+    present(true, skipSignal);
 
     // this class is for type CPU  //offset 5h
-#ifdef SMBIOS_MDRV1
-    family(cpuInfo->family);
-#elifdef SMBIOS_MDRV2
     family(cpuInfo->family, cpuInfo->family2); // offset 6h and 28h
-#endif
-    manufacturer(cpuInfo->manufacturer, cpuInfo->length,
-                 dataIn);                               // offset 7h
-    id(cpuInfo->id);                                    // offset 8h
-    version(cpuInfo->version, cpuInfo->length, dataIn); // offset 10h
-    maxSpeedInMhz(cpuInfo->maxSpeed);                   // offset 14h
-#ifdef SMBIOS_MDRV2
-    serialNumber(cpuInfo->serialNum, cpuInfo->length,
-                 dataIn); // offset 20h
-    partNumber(cpuInfo->partNum, cpuInfo->length,
-               dataIn);                          // offset 22h
-#endif
-    if (cpuInfo->coreCount < maxOldVersionCount) // offset 23h or 2Ah
+    manufacturer(strings[cpuInfo->manufacturer]); // offset 7h
+    id(cpuInfo->id, skipSignal);                  // offset 8h
+    version(strings[cpuInfo->version]);           // offset 10h
+    maxSpeedInMhz(cpuInfo->maxSpeed, skipSignal); // offset 14h
+    if constexpr (Policy::processorAssetNumbers)
     {
-        coreCount(cpuInfo->coreCount);
+        serialNumber(strings[cpuInfo->serialNum]); // offset 20h
+        partNumber(strings[cpuInfo->partNum]);     // offset 22h
+    }
+    // Only 3.0 structures hold the wider counts, and V1 accepts older ones.
+    bool hasCount2 = cpuInfo->length >= ProcessorFields::threadCount2.end();
+    if (cpuInfo->coreCount < maxOldVersionCount || !hasCount2) // 23h or 2Ah
+    {
+        coreCount(cpuInfo->coreCount, skipSignal);
     }
     else
     {
-        coreCount(cpuInfo->coreCount2);
+        coreCount(cpuInfo->coreCount2, skipSignal);
     }
 
-    if (cpuInfo->threadCount < maxOldVersionCount) // offset 25h or 2Eh)
+    if (cpuInfo->threadCount < maxOldVersionCount || !hasCount2) // 25h or 2Eh
     {
-        threadCount(cpuInfo->threadCount);
+        threadCount(cpuInfo->threadCount, skipSignal);
     }
     else
     {
-        threadCount(cpuInfo->threadCount2);
+        threadCount(cpuInfo->threadCount2, skipSignal);
     }
 
-    characteristics(cpuInfo->characteristics); // offset 26h
-#ifdef SMBIOS_MDRV2
-    if (!motherboardPath.empty())
+    if constexpr (Policy::processorCapabilities)
     {
-        std::vector<std::tuple<std::string, std::string, std::string>> assocs;
-        assocs.emplace_back("chassis", "processors", motherboardPath);
-        association::associations(assocs);
+        characteristics(cpuInfo->characteristics); // offset 26h
     }
-#endif
 }
 
+template class Cpu<MdrV1Policy>;
+template class Cpu<MdrV2Policy>;
+
 } // namespace smbios
 } // namespace phosphor
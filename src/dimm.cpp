@@ -16,15 +16,10 @@
 
 #include "dimm.hpp"
 
-#ifdef SMBIOS_MDRV1
-#include "mdrv1.hpp"
-#elifdef SMBIOS_MDRV2
-#include "mdrv2.hpp"
-#endif
-
-#include <boost/algorithm/string.hpp>
 #include <phosphor-logging/elog-errors.hpp>
 
+#include <cctype>
+
 namespace phosphor
 {
 namespace smbios
@@ -39,41 +34,32 @@ bool onlyDimmLocationCode = false;
 using DeviceType =
     sdbusplus::xyz::openbmc_project::Inventory::Item::server::Dimm::DeviceType;
 
-#ifdef SMBIOS_MDRV2
 using EccType =
     sdbusplus::xyz::openbmc_project::Inventory::Item::server::Dimm::Ecc;
-#endif
 
 static constexpr uint16_t maxOldDimmSize = 0x7fff;
-void Dimm::memoryInfoUpdate(void)
+template <typename Policy>
+void Dimm<Policy>::memoryInfoUpdate(void)
 {
-#ifdef SMBIOS_MDRV1
-	uint8_t *dataIn = regionS[0].regionData;
-#elifdef SMBIOS_MDRV2
-	uint8_t* dataIn = storage;
-#endif
-
-    dataIn = getSMBIOSTypePtr(dataIn, memoryDeviceType);
+    // Also cleared when the motherboard is not known (any more).
+    std::vector<std::tuple<std::string, std::string, std::string>> assocs;
+    if (!motherboardPath.empty())
+    {
+        assocs.emplace_back("chassis", "memories", motherboardPath);
+    }
+    sdbusplus::xyz::openbmc_project::Association::server::Definitions::
+        associations(assocs, skipSignal);
 
+    uint8_t* dataIn = smbiosIndex.get(memoryDeviceType, dimmNum);
     if (dataIn == nullptr)
     {
+        // A refreshed object must not keep the previous table's values.
+        clearInfo();
         return;
     }
-    for (uint8_t index = 0; index < dimmNum; index++)
-    {
-        dataIn = smbiosNextPtr(dataIn);
-        if (dataIn == nullptr)
-        {
-            return;
-        }
-        dataIn = getSMBIOSTypePtr(dataIn, memoryDeviceType);
-        if (dataIn == nullptr)
-        {
-            return;
-        }
-    }
 
     auto memoryInfo = reinterpret_cast<struct MemoryInfo*>(dataIn);
+    SmbiosStrings strings(dataIn);
 
     memoryDataWidth(memoryInfo->dataWidth);
 
@@ -86,89 +72,97 @@ void Dimm::memoryInfoUpdate(void)
         dimmSize(memoryInfo->size);
     }
 
-#ifdef SMBIOS_MDRV1
-    dimmDeviceLocator(memoryInfo->deviceLocator, memoryInfo->length, dataIn);
-#elifdef SMBIOS_MDRV2
-    dimmDeviceLocator(memoryInfo->bankLocator, memoryInfo->deviceLocator,
-                      memoryInfo->length, dataIn);
-#endif
+    dimmDeviceLocator(strings[memoryInfo->bankLocator],
+                      strings[memoryInfo->deviceLocator]);
     dimmType(memoryInfo->memoryType);
     dimmTypeDetail(memoryInfo->typeDetail);
     maxMemorySpeedInMhz(memoryInfo->speed);
-    dimmManufacturer(memoryInfo->manufacturer, memoryInfo->length, dataIn);
-    dimmSerialNum(memoryInfo->serialNum, memoryInfo->length, dataIn);
-    dimmPartNum(memoryInfo->partNum, memoryInfo->length, dataIn);
+    dimmManufacturer(strings[memoryInfo->manufacturer]);
+    dimmSerialNum(strings[memoryInfo->serialNum]);
+    dimmPartNum(strings[memoryInfo->partNum]);
     memoryAttributes(memoryInfo->attributes);
     memoryConfiguredSpeedInMhz(memoryInfo->confClockSpeed);
 
-#ifdef SMBIOS_MDRV2
-    updateEccType(memoryInfo->phyArrayHandle);
-
-    if (!motherboardPath.empty())
+    if constexpr (Policy::dimmEcc)
     {
-        std::vector<std::tuple<std::string, std::string, std::string>> assocs;
-        assocs.emplace_back("chassis", "memories", motherboardPath);
-        association::associations(assocs);
+        updateEccType(memoryInfo->phyArrayHandle);
     }
-#endif
 
     return;
 }
 
-#ifdef SMBIOS_MDRV2
-void Dimm::updateEccType(uint16_t exPhyArrayHandle)
+template <typename Policy>
+void Dimm<Policy>::clearInfo(void)
 {
-    uint8_t* dataIn = storage;
+    memoryDataWidth(0);
+    memorySizeInKB(0);
+    memoryDeviceLocator({});
+    locationCode({});
+    memoryType({});
+    memoryTypeDetail({});
+    maxMemorySpeedInMhz(0);
+    manufacturer({});
+    present(false);
+    functional(false);
+    serialNumber({});
+    partNumber({});
+    memoryAttributes(0);
+    memoryConfiguredSpeedInMhz(0);
+    ecc({});
+}
 
-    while (dataIn != nullptr)
+template <typename Policy>
+void Dimm<Policy>::updateEccType(uint16_t exPhyArrayHandle)
+{
+    if (smbiosIndex.count(physicalMemoryArrayType) == 0)
     {
-        dataIn = getSMBIOSTypePtr(dataIn, physicalMemoryArrayType);
-        if (dataIn == nullptr)
-        {
-            phosphor::logging::log<phosphor::logging::level::ERR>(
-                "Failed to get SMBIOS table type-16 data.");
-            return;
-        }
+        phosphor::logging::log<phosphor::logging::level::ERR>(
+            "Failed to get SMBIOS table type-16 data.");
+        ecc({});
+        return;
+    }
 
-        auto info = reinterpret_cast<struct PhysicalMemoryArrayInfo*>(dataIn);
-        if (info->handle == exPhyArrayHandle)
-        {
-            std::map<uint8_t, EccType>::const_iterator it =
-                dimmEccTypeMap.find(info->memoryErrorCorrection);
-            if (it == dimmEccTypeMap.end())
-            {
-                ecc(EccType::NoECC);
-            }
-            else
-            {
-                ecc(it->second);
-            }
-            return;
-        }
+    uint8_t* dataIn = smbiosIndex.getByHandle(exPhyArrayHandle);
+    if (dataIn == nullptr || *dataIn != physicalMemoryArrayType)
+    {
+        phosphor::logging::log<phosphor::logging::level::ERR>(
+            "Failed find the corresponding SMBIOS table type-16 data for dimm:",
+            phosphor::logging::entry("DIMM:%d", dimmNum));
+        ecc({});
+        return;
+    }
 
-        dataIn = smbiosNextPtr(dataIn);
+    auto info = reinterpret_cast<struct PhysicalMemoryArrayInfo*>(dataIn);
+    std::map<uint8_t, EccType>::const_iterator it =
+        dimmEccTypeMap.find(info->memoryErrorCorrection);
+    if (it == dimmEccTypeMap.end())
+    {
+        ecc(EccType::NoECC);
+    }
+    else
+    {
+        ecc(it->second);
     }
-    phosphor::logging::log<phosphor::logging::level::ERR>(
-        "Failed find the corresponding SMBIOS table type-16 data for dimm:",
-        phosphor::logging::entry("DIMM:%d", dimmNum));
 }
 
-EccType Dimm::ecc(EccType value)
+template <typename Policy>
+EccType Dimm<Policy>::ecc(EccType value)
 {
     return sdbusplus::xyz::openbmc_project::Inventory::Item::server::Dimm::ecc(
-        value);
+        value, skipSignal);
 }
-#endif
 
-uint16_t Dimm::memoryDataWidth(uint16_t value)
+template <typename Policy>
+uint16_t Dimm<Policy>::memoryDataWidth(uint16_t value)
 {
     return sdbusplus::xyz::openbmc_project::Inventory::Item::server::Dimm::
-        memoryDataWidth(value);
+        memoryDataWidth(value, skipSignal);
 }
 
 static constexpr uint16_t baseNewVersionDimmSize = 0x8000;
 static constexpr uint16_t dimmSizeUnit = 1024;
-void Dimm::dimmSize(const uint16_t size)
+template <typename Policy>
+void Dimm<Policy>::dimmSize(const uint16_t size)
 {
     size_t result = size & maxOldDimmSize;
     if (0 == (size & baseNewVersionDimmSize))
@@ -178,63 +172,50 @@ void Dimm::dimmSize(const uint16_t size)
     memorySizeInKB(result);
 }
 
-void Dimm::dimmSizeExt(size_t size)
+template <typename Policy>
+void Dimm<Policy>::dimmSizeExt(size_t size)
 {
     size = size * dimmSizeUnit;
     memorySizeInKB(size);
 }
 
-size_t Dimm::memorySizeInKB(size_t value)
+template <typename Policy>
+size_t Dimm<Policy>::memorySizeInKB(size_t value)
 {
     return sdbusplus::xyz::openbmc_project::Inventory::Item::server::Dimm::
-        memorySizeInKB(value);
+        memorySizeInKB(value, skipSignal);
 }
 
-#ifdef SMBIOS_MDRV1
-void Dimm::dimmDeviceLocator(uint8_t positionNum, uint8_t structLen,
-	                             uint8_t *dataIn)
+template <typename Policy>
+void Dimm<Policy>::dimmDeviceLocator(std::string_view bankLocator,
+                                      std::string_view deviceLocator)
 {
-	std::string result;
-
-	result = positionToString(positionNum, structLen, dataIn);
+    std::string result;
+    if (!Policy::dimmBankLocator || bankLocator.empty() ||
+        onlyDimmLocationCode)
+    {
+        result = deviceLocator;
+    }
+    else
+    {
+        result.reserve(bankLocator.size() + 1 + deviceLocator.size());
+        result.append(bankLocator).append(" ").append(deviceLocator);
+    }
 
-	memoryDeviceLocator(result);
+    memoryDeviceLocator(result);
 
-	locationCode(result);
+    locationCode(result);
 }
-#elifdef SMBIOS_MDRV2
-void Dimm::dimmDeviceLocator(const uint8_t bankLocatorPositionNum,
-		                     const uint8_t deviceLocatorPositionNum,
-		                     const uint8_t structLen, uint8_t* dataIn)
-{
-	std::string deviceLocator =
-	        positionToString(deviceLocatorPositionNum, structLen, dataIn);
-	std::string bankLocator =
-	        positionToString(bankLocatorPositionNum, structLen, dataIn);
-
-	std::string result;
-	if (bankLocator.empty() || onlyDimmLocationCode)
-	{
-	    result = deviceLocator;
-	}
-	else
-	{
-	    result = bankLocator + " " + deviceLocator;
-	}
-
-	memoryDeviceLocator(result);
-
-	locationCode(result);
-}
-#endif
 
-std::string Dimm::memoryDeviceLocator(std::string value)
+template <typename Policy>
+std::string Dimm<Policy>::memoryDeviceLocator(std::string value)
 {
     return sdbusplus::xyz::openbmc_project::Inventory::Item::server::Dimm::
-        memoryDeviceLocator(value);
+        memoryDeviceLocator(value, skipSignal);
 }
 
-void Dimm::dimmType(const uint8_t type)
+template <typename Policy>
+void Dimm<Policy>::dimmType(const uint8_t type)
 {
     std::map<uint8_t, DeviceType>::const_iterator it = dimmTypeTable.find(type);
     if (it == dimmTypeTable.end())
@@ -247,13 +228,15 @@ void Dimm::dimmType(const uint8_t type)
     }
 }
 
-DeviceType Dimm::memoryType(DeviceType value)
+template <typename Policy>
+DeviceType Dimm<Policy>::memoryType(DeviceType value)
 {
     return sdbusplus::xyz::openbmc_project::Inventory::Item::server::Dimm::
-        memoryType(value);
+        memoryType(value, skipSignal);
 }
 
-void Dimm::dimmTypeDetail(uint16_t detail)
+template <typename Policy>
+void Dimm<Policy>::dimmTypeDetail(uint16_t detail)
 {
     std::string result;
     for (uint8_t index = 0; index < (8 * sizeof(detail)); index++)
@@ -267,104 +250,114 @@ void Dimm::dimmTypeDetail(uint16_t detail)
     memoryTypeDetail(result);
 }
 
-std::string Dimm::memoryTypeDetail(std::string value)
+template <typename Policy>
+std::string Dimm<Policy>::memoryTypeDetail(std::string value)
 {
     return sdbusplus::xyz::openbmc_project::Inventory::Item::server::Dimm::
-        memoryTypeDetail(value);
+        memoryTypeDetail(value, skipSignal);
 }
 
-uint16_t Dimm::maxMemorySpeedInMhz(uint16_t value)
+template <typename Policy>
+uint16_t Dimm<Policy>::maxMemorySpeedInMhz(uint16_t value)
 {
     return sdbusplus::xyz::openbmc_project::Inventory::Item::server::Dimm::
-        maxMemorySpeedInMhz(value);
+        maxMemorySpeedInMhz(value, skipSignal);
 }
 
-void Dimm::dimmManufacturer(const uint8_t positionNum, const uint8_t structLen,
-                            uint8_t* dataIn)
+template <typename Policy>
+void Dimm<Policy>::dimmManufacturer(std::string_view value)
 {
-    std::string result = positionToString(positionNum, structLen, dataIn);
-
     bool val = true;
-    if (result == "NO DIMM")
+    if (value == "NO DIMM")
     {
         val = false;
 
         // No dimm presence so making manufacturer value as "" (instead of
         // NO DIMM - as there won't be any manufacturer for DIMM which is not
         // present).
-        result = "";
+        value = {};
     }
-    manufacturer(result);
+    manufacturer(std::string(value));
     present(val);
     functional(val);
 }
 
-std::string Dimm::manufacturer(std::string value)
+template <typename Policy>
+std::string Dimm<Policy>::manufacturer(std::string value)
 {
     return sdbusplus::xyz::openbmc_project::Inventory::Decorator::server::
-        Asset::manufacturer(value);
+        Asset::manufacturer(value, skipSignal);
 }
 
-bool Dimm::present(bool value)
+template <typename Policy>
+bool Dimm<Policy>::present(bool value)
 {
     return sdbusplus::xyz::openbmc_project::Inventory::server::Item::present(
-        value);
+        value, skipSignal);
 }
 
-void Dimm::dimmSerialNum(const uint8_t positionNum, const uint8_t structLen,
-                         uint8_t* dataIn)
+template <typename Policy>
+void Dimm<Policy>::dimmSerialNum(std::string_view value)
 {
-    std::string result = positionToString(positionNum, structLen, dataIn);
-
-    serialNumber(result);
+    serialNumber(std::string(value));
 }
 
-std::string Dimm::serialNumber(std::string value)
+template <typename Policy>
+std::string Dimm<Policy>::serialNumber(std::string value)
 {
     return sdbusplus::xyz::openbmc_project::Inventory::Decorator::server::
-        Asset::serialNumber(value);
+        Asset::serialNumber(value, skipSignal);
 }
 
-void Dimm::dimmPartNum(const uint8_t positionNum, const uint8_t structLen,
-                       uint8_t* dataIn)
+template <typename Policy>
+void Dimm<Policy>::dimmPartNum(std::string_view value)
 {
-    std::string result = positionToString(positionNum, structLen, dataIn);
-
     // Part number could contain spaces at the end. Eg: "abcd123  ". Since its
     // unnecessary, we should remove them.
-    boost::algorithm::trim_right(result);
-    partNumber(result);
+    while (!value.empty() && std::isspace(static_cast<uint8_t>(value.back())))
+    {
+        value.remove_suffix(1);
+    }
+    partNumber(std::string(value));
 }
 
-std::string Dimm::partNumber(std::string value)
+template <typename Policy>
+std::string Dimm<Policy>::partNumber(std::string value)
 {
     return sdbusplus::xyz::openbmc_project::Inventory::Decorator::server::
-        Asset::partNumber(value);
+        Asset::partNumber(value, skipSignal);
 }
 
-std::string Dimm::locationCode(std::string value)
+template <typename Policy>
+std::string Dimm<Policy>::locationCode(std::string value)
 {
     return sdbusplus::xyz::openbmc_project::Inventory::Decorator::server::
-        LocationCode::locationCode(value);
+        LocationCode::locationCode(value, skipSignal);
 }
 
-uint8_t Dimm::memoryAttributes(uint8_t value)
+template <typename Policy>
+uint8_t Dimm<Policy>::memoryAttributes(uint8_t value)
 {
     return sdbusplus::xyz::openbmc_project::Inventory::Item::server::Dimm::
-        memoryAttributes(value);
+        memoryAttributes(value, skipSignal);
 }
 
-uint16_t Dimm::memoryConfiguredSpeedInMhz(uint16_t value)
+template <typename Policy>
+uint16_t Dimm<Policy>::memoryConfiguredSpeedInMhz(uint16_t value)
 {
     return sdbusplus::xyz::openbmc_project::Inventory::Item::server::Dimm::
-        memoryConfiguredSpeedInMhz(value);
+        memoryConfiguredSpeedInMhz(value, skipSignal);
 }
 
-bool Dimm::functional(bool value)
+template <typename Policy>
+bool Dimm<Policy>::functional(bool value)
 {
     return sdbusplus::xyz::openbmc_project::State::Decorator::server::
-        OperationalStatus::functional(value);
+        OperationalStatus::functional(value, skipSignal);
 }
 
+template class Dimm<MdrV1Policy>;
+template class Dimm<MdrV2Policy>;
+
 } // namespace smbios
 } // namespace phosphor
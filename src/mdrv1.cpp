@@ -97,69 +97,31 @@ uint8_t MDR_V1::calcCRC8(const uint8_t regionId)
     return crc;
 }
 
+constexpr int limitEntryLen = 0xff;
 uint8_t MDR_V1::getTotalDimmSlot()
 {
-    uint8_t *dataIn = regionS[0].regionData;
-    uint8_t num = 0;
-
-    if (dataIn == nullptr)
+    if (smbiosIndex.data() == nullptr)
     {
         phosphor::logging::log<phosphor::logging::level::ERR>(
             "get dimm total slot failed - no region data");
         return 0;
     }
 
-    int limit = 0xff;
-    while (limit > 0)
-    {
-        dataIn = getSMBIOSTypePtr(dataIn, memoryDeviceType);
-        if (dataIn == nullptr)
-        {
-            break;
-        }
-        num++;
-        dataIn = smbiosNextPtr(dataIn);
-        if (dataIn == nullptr)
-        {
-            break;
-        }
-        limit--;
-    }
-
-    return num;
+    return std::min<size_t>(smbiosIndex.count(memoryDeviceType),
+                            limitEntryLen);
 }
 
-constexpr int limitEntryLen = 0xff;
 uint8_t MDR_V1::getTotalCpuSlot()
 {
-    uint8_t *dataIn = regionS[0].regionData;
-    uint8_t num = 0;
-
-    if (dataIn == nullptr)
+    if (smbiosIndex.data() == nullptr)
     {
         phosphor::logging::log<phosphor::logging::level::ERR>(
             "get cpu total slot failed - no region data");
         return 0;
     }
 
-    int limit = limitEntryLen;
-    while (limit > 0)
-    {
-        dataIn = getSMBIOSTypePtr(dataIn, processorsType);
-        if (dataIn == nullptr)
-        {
-            break;
-        }
-        num++;
-        dataIn = smbiosNextPtr(dataIn);
-        if (dataIn == nullptr)
-        {
-            break;
-        }
-        limit--;
-    }
-
-    return num;
+    return std::min<size_t>(smbiosIndex.count(processorsType),
+                            limitEntryLen);
 }
 
 void MDR_V1::systemInfoUpdate()
@@ -167,17 +129,35 @@ void MDR_V1::systemInfoUpdate()
     uint8_t num = 0;
     std::string path;
 
+    VerifyError error{};
+    std::optional<VerifiedTable> verified = VerifiedTable::verify(
+        regionS[0].regionData, mdrSMBIOSSize, MdrV1Policy::requiredLengths,
+        &error);
+    if (verified)
+    {
+        smbiosIndex.build(*verified);
+    }
+    else
+    {
+        phosphor::logging::log<phosphor::logging::level::ERR>(
+            "SMBIOS table is malformed, no inventory will be created",
+            phosphor::logging::entry("OFFSET=%zu", error.offset),
+            phosphor::logging::entry("TYPE=%d", error.type),
+            phosphor::logging::entry("LENGTH=%d", error.length));
+        smbiosIndex.clear();
+    }
     num = getTotalDimmSlot();
 
     // Clear all dimm cpu interface first
-    std::vector<std::unique_ptr<Dimm>>().swap(dimms);
-    std::vector<std::unique_ptr<Cpu>>().swap(cpus);
+    std::vector<std::unique_ptr<Dimm<MdrV1Policy>>>().swap(dimms);
+    std::vector<std::unique_ptr<Cpu<MdrV1Policy>>>().swap(cpus);
 
     for (int index = 0; index < num; index++)
     {
         path = dimmPath + std::to_string(index);
-        dimms.emplace_back(std::make_unique<phosphor::smbios::Dimm>(
-            bus, path, index, &regionS[0]));
+        dimms.emplace_back(
+            std::make_unique<phosphor::smbios::Dimm<MdrV1Policy>>(
+                bus, path, index, smbiosIndex));
     }
 
     num = 0;
@@ -186,8 +166,9 @@ void MDR_V1::systemInfoUpdate()
     for (int index = 0; index < num; index++)
     {
         path = cpuPath + std::to_string(index);
-        cpus.emplace_back(std::make_unique<phosphor::smbios::Cpu>(
-            bus, path, index, &regionS[0]));
+        cpus.emplace_back(
+            std::make_unique<phosphor::smbios::Cpu<MdrV1Policy>>(
+                bus, path, index, smbiosIndex));
     }
 }
 
@@ -206,9 +187,9 @@ bool MDR_V1::readDataFromFlash(uint8_t *data, const char *file)
     filePtr.read(reinterpret_cast<char *>(&(pRegionS->state)),
                  sizeof(MDRState));
     filePtr.read(reinterpret_cast<char *>(pRegionS->regionData),
-                 (pRegionS->state.regionLength < smbiosTableStorageSize
+                 (pRegionS->state.regionLength < mdrV1TableStorageSize
                       ? pRegionS->state.regionLength
-                      : smbiosTableStorageSize));
+                      : mdrV1TableStorageSize));
     return true;
 }
 
@@ -271,9 +252,9 @@ void MDR_V1::regionComplete(uint8_t regionId)
         return;
     }
 
-    if (access(smbiosPath, F_OK) == -1)
+    if (access(mdrV1Dir, F_OK) == -1)
     {
-        if (0 != mkdir(smbiosPath, S_IRWXU))
+        if (0 != mkdir(mdrV1Dir, S_IRWXU))
         {
             phosphor::logging::log<phosphor::logging::level::ERR>(
                 "create folder failed for writting smbios file");
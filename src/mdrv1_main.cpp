@@ -14,6 +14,7 @@
 // limitations under the License.
 */
 
+#include "mdr_main.hpp"
 #include "mdrv1.hpp"
 #include "smbios.hpp"
 #include <systemd/sd-event.h>
@@ -65,7 +66,7 @@ struct ManagedDataRegion regionS[] = {
      0},
 };
 
-int main(void)
+int phosphor::smbios::runMdrV1(void)
 {
     sd_event *events = nullptr;
     sd_event_default(&events);
@@ -20,11 +20,16 @@
 
 #include <sys/mman.h>
 
+#include <boost/asio/post.hpp>
 #include <phosphor-logging/elog-errors.hpp>
 #include <sdbusplus/exception.hpp>
 #include <xyz/openbmc_project/Smbios/MDR_V2/error.hpp>
 
+#include <cerrno>
+#include <cstdio>
 #include <fstream>
+#include <future>
+#include <limits>
 
 namespace phosphor
 {
@@ -35,8 +40,7 @@ std::vector<uint8_t> MDR_V2::getDirectoryInformation(uint8_t dirIndex)
 {
     std::vector<uint8_t> responseDir;
 
-    std::ifstream smbiosFile(mdrType2File, std::ios_base::binary);
-    if (!smbiosFile.good())
+    if (!tableFileExists)
     {
         phosphor::logging::log<phosphor::logging::level::ERR>(
             "Read data from flash error - Open MDRV2 table file failure");
@@ -202,55 +206,39 @@ std::vector<uint8_t> MDR_V2::getDataInformation(uint8_t idIndex)
     return responseInfo;
 }
 
-bool MDR_V2::readDataFromFlash(MDRSMBIOSHeader* mdrHdr, uint8_t* data)
+bool MDR_V2::readDataFromFlash(TableFile& file, bool& fileExists)
 {
-    if (mdrHdr == nullptr)
+    LoadError error{};
+    std::optional<TableFile> loaded =
+        TableFile::load(mdrType2File, smbiosTableStorageSize, &error);
+    fileExists = loaded || error != LoadError::open;
+    if (!loaded)
     {
-        phosphor::logging::log<phosphor::logging::level::ERR>(
-            "Read data from flash error - Invalid mdr header");
-        return false;
-    }
-    if (data == nullptr)
-    {
-        phosphor::logging::log<phosphor::logging::level::ERR>(
-            "Read data from flash error - Invalid data point");
-        return false;
-    }
-    std::ifstream smbiosFile(mdrType2File, std::ios_base::binary);
-    if (!smbiosFile.good())
-    {
-        phosphor::logging::log<phosphor::logging::level::ERR>(
-            "Read data from flash error - Open MDRV2 table file failure");
-        return false;
-    }
-    smbiosFile.clear();
-    smbiosFile.seekg(0, std::ios_base::end);
-    int fileLength = smbiosFile.tellg();
-    smbiosFile.seekg(0, std::ios_base::beg);
-    if (fileLength < sizeof(MDRSMBIOSHeader))
-    {
-        phosphor::logging::log<phosphor::logging::level::ERR>(
-            "MDR V2 file size is smaller than mdr header");
-        return false;
-    }
-    smbiosFile.read(reinterpret_cast<char*>(mdrHdr), sizeof(MDRSMBIOSHeader));
-    if (mdrHdr->dataSize > smbiosTableStorageSize)
-    {
-        phosphor::logging::log<phosphor::logging::level::ERR>(
-            "Data size out of limitation");
-        smbiosFile.close();
+        switch (error)
+        {
+            case LoadError::open:
+                phosphor::logging::log<phosphor::logging::level::ERR>(
+                    "Read data from flash error - Open MDRV2 table file "
+                    "failure");
+                break;
+            case LoadError::tooSmall:
+                phosphor::logging::log<phosphor::logging::level::ERR>(
+                    "MDR V2 file size is smaller than mdr header");
+                break;
+            case LoadError::tooLarge:
+                phosphor::logging::log<phosphor::logging::level::ERR>(
+                    "Data size out of limitation");
+                break;
+            case LoadError::read:
+                phosphor::logging::log<phosphor::logging::level::ERR>(
+                    "Read data from flash error - Read MDRV2 table file "
+                    "failure",
+                    phosphor::logging::entry("ERRNO=%d", errno));
+                break;
+        }
         return false;
     }
-    fileLength -= sizeof(MDRSMBIOSHeader);
-    if (fileLength < mdrHdr->dataSize)
-    {
-        smbiosFile.read(reinterpret_cast<char*>(data), fileLength);
-    }
-    else
-    {
-        smbiosFile.read(reinterpret_cast<char*>(data), mdrHdr->dataSize);
-    }
-    smbiosFile.close();
+    file = std::move(*loaded);
     return true;
 }
 
@@ -377,8 +365,7 @@ int MDR_V2::findIdIndex(std::vector<uint8_t> dataInfo)
 
 uint8_t MDR_V2::directoryEntries(uint8_t value)
 {
-    std::ifstream smbiosFile(mdrType2File, std::ios_base::binary);
-    if (!smbiosFile.good())
+    if (!tableFileExists)
     {
         phosphor::logging::log<phosphor::logging::level::ERR>(
             "Read data from flash error - Open MDRV2 table file failure");
@@ -392,9 +379,29 @@ uint8_t MDR_V2::directoryEntries(uint8_t value)
         directoryEntries(value);
 }
 
-void MDR_V2::systemInfoUpdate()
+// Keep the first count objects and re-read them, create the missing ones
+// and drop the rest. Object N always shows the Nth structure of its kind.
+template <typename Object, typename Create>
+void reconcile(std::vector<std::unique_ptr<Object>>& objects, int count,
+               const std::string& motherboardPath, Create&& create)
 {
-    std::string motherboardPath;
+    if (objects.size() > static_cast<size_t>(count))
+    {
+        objects.erase(objects.begin() + count, objects.end());
+    }
+    for (std::unique_ptr<Object>& object : objects)
+    {
+        object->refresh(motherboardPath);
+    }
+    for (int index = objects.size(); index < count; index++)
+    {
+        objects.emplace_back(create(index));
+    }
+}
+
+void MDR_V2::systemInfoUpdate(std::bitset<256> changedTypes)
+{
+    std::string motherboard;
     auto method = bus.new_method_call(mapperBusName, mapperPath,
                                       mapperInterface, "GetSubTreePaths");
     method.append(systemInterfacePath);
@@ -437,7 +444,7 @@ void MDR_V2::systemInfoUpdate()
         }
         else
         {
-            motherboardPath = std::move(paths[0]);
+            motherboard = std::move(paths[0]);
         }
     }
     catch (const sdbusplus::exception_t& e)
@@ -447,275 +454,338 @@ void MDR_V2::systemInfoUpdate()
             phosphor::logging::entry("ERROR=%s", e.what()));
     }
 
-    cpus.clear();
-    int num = getTotalCpuSlot();
-    if (num == -1)
+    // Every association names the motherboard.
+    if (motherboard != motherboardPath)
     {
-        phosphor::logging::log<phosphor::logging::level::ERR>(
-            "get cpu total slot failed");
-        return;
+        motherboardPath = std::move(motherboard);
+        changedTypes.set();
     }
 
-    for (int index = 0; index < num; index++)
+    if (changedTypes[processorsType])
     {
-        std::string path = cpuPath + std::to_string(index);
-        cpus.emplace_back(std::make_unique<phosphor::smbios::Cpu>(
-            bus, path, index, smbiosDir.dir[smbiosDirIndex].dataStorage,
-            motherboardPath));
+        int num = getTotalCpuSlot();
+        if (num == -1)
+        {
+            phosphor::logging::log<phosphor::logging::level::ERR>(
+                "get cpu total slot failed");
+            return;
+        }
+
+        reconcile(cpus, num, motherboardPath, [&](int index) {
+            std::string path = cpuPath + std::to_string(index);
+            return std::make_unique<phosphor::smbios::Cpu<MdrV2Policy>>(
+                bus, path, index, smbiosIndex, motherboardPath);
+        });
     }
 
 #ifdef DIMM_DBUS
 
-    dimms.clear();
-
-    num = getTotalDimmSlot();
-    if (num == -1)
+    if (changedTypes[memoryDeviceType] || changedTypes[physicalMemoryArrayType])
     {
-        phosphor::logging::log<phosphor::logging::level::ERR>(
-            "get dimm total slot failed");
-        return;
-    }
+        int num = getTotalDimmSlot();
+        if (num == -1)
+        {
+            phosphor::logging::log<phosphor::logging::level::ERR>(
+                "get dimm total slot failed");
+            return;
+        }
 
-    for (int index = 0; index < num; index++)
-    {
-        std::string path = dimmPath + std::to_string(index);
-        dimms.emplace_back(std::make_unique<phosphor::smbios::Dimm>(
-            bus, path, index, smbiosDir.dir[smbiosDirIndex].dataStorage,
-            motherboardPath));
+        reconcile(dimms, num, motherboardPath, [&](int index) {
+            std::string path = dimmPath + std::to_string(index);
+            return std::make_unique<phosphor::smbios::Dimm<MdrV2Policy>>(
+                bus, path, index, smbiosIndex, motherboardPath);
+        });
     }
 
 #endif
 
-    pcies.clear();
-    num = getTotalPcieSlot();
-    if (num == -1)
+    if (changedTypes[systemSlots])
     {
-        phosphor::logging::log<phosphor::logging::level::ERR>(
-            "get pcie total slot failed");
-        return;
+        int num = getTotalPcieSlot();
+        if (num == -1)
+        {
+            phosphor::logging::log<phosphor::logging::level::ERR>(
+                "get pcie total slot failed");
+            return;
+        }
+
+        reconcile(pcies, num, motherboardPath, [&](int index) {
+            std::string path = pciePath + std::to_string(index);
+            return std::make_unique<phosphor::smbios::Pcie>(
+                bus, path, index, smbiosIndex, motherboardPath);
+        });
     }
 
-    for (int index = 0; index < num; index++)
+    if (!system)
     {
-        std::string path = pciePath + std::to_string(index);
-        pcies.emplace_back(std::make_unique<phosphor::smbios::Pcie>(
-            bus, path, index, smbiosDir.dir[smbiosDirIndex].dataStorage,
-            motherboardPath));
+        system = std::make_unique<System>(bus, systemPath, smbiosIndex);
+    }
+    else if (changedTypes[biosType] || changedTypes[systemType])
+    {
+        system->refresh();
     }
-
-    system.reset();
-    system = std::make_unique<System>(
-        bus, systemPath, smbiosDir.dir[smbiosDirIndex].dataStorage);
 }
 
 int MDR_V2::getTotalCpuSlot()
 {
-    uint8_t* dataIn = smbiosDir.dir[smbiosDirIndex].dataStorage;
-    int num = 0;
-
-    if (dataIn == nullptr)
+    if (smbiosIndex.data() == nullptr)
     {
         phosphor::logging::log<phosphor::logging::level::ERR>(
             "get cpu total slot failed - no storage data");
         return -1;
     }
 
-    while (1)
-    {
-        dataIn = getSMBIOSTypePtr(dataIn, processorsType);
-        if (dataIn == nullptr)
-        {
-            break;
-        }
-        num++;
-        dataIn = smbiosNextPtr(dataIn);
-        if (dataIn == nullptr)
-        {
-            break;
-        }
-        if (num >= limitEntryLen)
-        {
-            break;
-        }
-    }
-
-    return num;
+    return std::min<int>(smbiosIndex.count(processorsType), limitEntryLen);
 }
 
 int MDR_V2::getTotalDimmSlot()
 {
-    uint8_t* dataIn = smbiosDir.dir[smbiosDirIndex].dataStorage;
-    uint8_t num = 0;
-
-    if (dataIn == nullptr)
+    if (smbiosIndex.data() == nullptr)
     {
         phosphor::logging::log<phosphor::logging::level::ERR>(
             "Fail to get dimm total slot - no storage data");
         return -1;
     }
 
-    while (1)
-    {
-        dataIn = getSMBIOSTypePtr(dataIn, memoryDeviceType);
-        if (dataIn == nullptr)
-        {
-            break;
-        }
-        num++;
-        dataIn = smbiosNextPtr(dataIn);
-        if (dataIn == nullptr)
-        {
-            break;
-        }
-        if (num >= limitEntryLen)
-        {
-            break;
-        }
-    }
-
-    return num;
+    return std::min<int>(smbiosIndex.count(memoryDeviceType), limitEntryLen);
 }
 
 int MDR_V2::getTotalPcieSlot()
 {
-    uint8_t* dataIn = smbiosDir.dir[smbiosDirIndex].dataStorage;
-    int num = 0;
-
-    if (dataIn == nullptr)
+    if (smbiosIndex.data() == nullptr)
     {
         phosphor::logging::log<phosphor::logging::level::ERR>(
             "Fail to get total system slot - no storage data");
         return -1;
     }
 
-    while (1)
+    auto slots =
+        smbiosIndex.structures(systemSlots) | std::views::filter(isPcieSlot);
+    int num = std::ranges::distance(slots);
+
+    return std::min(num, limitEntryLen);
+}
+
+bool MDR_V2::checkSMBIOSVersion(const SMBIOSVersion& version)
+{
+    lg2::info("SMBIOS VERSION - {MAJOR}.{MINOR}", "MAJOR",
+              version.majorVersion, "MINOR", version.minorVersion);
+
+    return isSupportedSMBIOSVersion(version);
+}
+
+bool MDR_V2::agentSynchronizeData()
+{
+    // The worker runs one load at a time, so this one cannot start before
+    // a sync already running has finished with the table in use.
+    uint64_t load = ++loadCount;
+    std::packaged_task<TableSnapshot()> task(
+        [inUse = verifiedTable, inUseHash = tableHash]() {
+            return loadTable(inUse, inUseHash);
+        });
+    std::future<TableSnapshot> loaded = task.get_future();
+    boost::asio::post(worker, std::move(task));
+
+    TableSnapshot snapshot = loaded.get();
+    bool accepted = snapshot.outcome != TableSnapshot::Outcome::failed;
+    publishTable(std::move(snapshot), load);
+    return accepted;
+}
+
+uint64_t MDR_V2::startSync()
+{
+    uint64_t token = ++syncTokens;
+    if (!syncRunning)
     {
-        dataIn = getSMBIOSTypePtr(dataIn, systemSlots);
-        if (dataIn == nullptr)
-        {
-            break;
-        }
+        runSync();
+    }
+    return token;
+}
 
-        /* System slot type offset. Check if the slot is a PCIE slots. All
-         * PCIE slot type are hardcoded in a table.
-         */
-        if (pcieSmbiosType.find(*(dataIn + 5)) != pcieSmbiosType.end())
-        {
-            num++;
-        }
-        dataIn = smbiosNextPtr(dataIn);
-        if (dataIn == nullptr)
-        {
-            break;
-        }
-        if (num >= limitEntryLen)
-        {
-            break;
-        }
+void MDR_V2::runSync()
+{
+    syncRunning = true;
+    uint64_t first = syncCovered + 1;
+    syncCovered = syncTokens;
+
+    // Loading and decoding a table takes long enough to stall every D-Bus
+    // request queued behind it, so only the publishing runs on this thread.
+    boost::asio::post(worker, [this, first, last = syncCovered,
+                               load = ++loadCount, inUse = verifiedTable,
+                               inUseHash = tableHash]() {
+        TableSnapshot snapshot = loadTable(inUse, inUseHash);
+        boost::asio::post(io, [this, first, last, load,
+                               snapshot = std::move(snapshot)]() mutable {
+            bool accepted = snapshot.outcome != TableSnapshot::Outcome::failed;
+            publishTable(std::move(snapshot), load);
+            finishSync(first, last, accepted);
+        });
+    });
+}
+
+void MDR_V2::finishSync(uint64_t first, uint64_t last, bool accepted)
+{
+    syncRunning = false;
+    for (uint64_t token = first; token <= last; token++)
+    {
+        sdbusplus::message_t signal = syncInterface->new_signal("SyncFinished");
+        signal.append(token, accepted);
+        signal.signal_send();
     }
 
-    return num;
+    if (syncCovered < syncTokens)
+    {
+        runSync();
+    }
 }
 
-bool MDR_V2::checkSMBIOSVersion(uint8_t* dataIn)
+TableSnapshot MDR_V2::loadTable(std::optional<VerifiedTable> inUse,
+                                std::optional<TableHash> inUseHash)
 {
-    const std::string anchorString21 = "_SM_";
-    const std::string anchorString30 = "_SM3_";
-    std::string buffer(dataIn, dataIn + smbiosTableStorageSize);
+    TableSnapshot snapshot;
+    if (!readDataFromFlash(snapshot.file, snapshot.fileExists))
+    {
+        phosphor::logging::log<phosphor::logging::level::ERR>(
+            "agent data sync failed - read data from flash failed");
+        return snapshot;
+    }
+    snapshot.header = snapshot.file.header();
 
-    auto it = std::search(std::begin(buffer), std::end(buffer),
-                          std::begin(anchorString21), std::end(anchorString21));
-    bool smbios21Found = it != std::end(buffer);
-    if (!smbios21Found)
+    std::span<uint8_t> storage = snapshot.file.data();
+    std::optional<EntryPoint> entryPoint =
+        findEntryPoint(storage.data(), storage.size(), mdr2SMBaseAddress);
+    if (!entryPoint)
     {
-        phosphor::logging::log<phosphor::logging::level::INFO>(
-            "SMBIOS 2.1 Anchor String not found. Looking for SMBIOS 3.0");
-        it = std::search(std::begin(buffer), std::end(buffer),
-                         std::begin(anchorString30), std::end(anchorString30));
-        if (it == std::end(buffer))
-        {
-            phosphor::logging::log<phosphor::logging::level::ERR>(
-                "SMBIOS 2.1 and 3.0 Anchor Strings not found");
-            return false;
-        }
+        phosphor::logging::log<phosphor::logging::level::ERR>(
+            "No valid SMBIOS 2.1 or 3.0 entry point found");
+        return snapshot;
     }
 
-    auto pos = std::distance(std::begin(buffer), it);
-    auto length = smbiosTableStorageSize - pos;
-    uint8_t foundMajorVersion;
-    uint8_t foundMinorVersion;
+    // Hosts mostly send the table they sent last time; then there is
+    // nothing to check or rebuild.
+    snapshot.hash =
+        sha256(storage.data() + entryPoint->tableOffset, entryPoint->tableSize);
+    if (inUseHash == snapshot.hash)
+    {
+        lg2::info("SMBIOS table unchanged");
+        snapshot.outcome = TableSnapshot::Outcome::unchanged;
+        return snapshot;
+    }
 
-    if (smbios21Found)
+    if (!checkSMBIOSVersion(entryPoint->version))
     {
-        if (length < sizeof(EntryPointStructure21))
-        {
-            phosphor::logging::log<phosphor::logging::level::ERR>(
-                "Invalid entry point structure for SMBIOS 2.1");
-            return false;
-        }
+        phosphor::logging::log<phosphor::logging::level::ERR>(
+            "Unsupported SMBIOS table version");
+        return snapshot;
+    }
 
-        auto epStructure =
-            reinterpret_cast<const EntryPointStructure21*>(&dataIn[pos]);
-        foundMajorVersion = epStructure->smbiosVersion.majorVersion;
-        foundMinorVersion = epStructure->smbiosVersion.minorVersion;
+    VerifyError error{};
+    snapshot.table = VerifiedTable::verify(
+        storage.data() + entryPoint->tableOffset, entryPoint->tableSize,
+        MdrV2Policy::requiredLengths, &error);
+    if (!snapshot.table)
+    {
+        phosphor::logging::log<phosphor::logging::level::ERR>(
+            error.reason == VerifyError::Reason::tooShort
+                ? "SMBIOS structure shorter than required"
+                : "SMBIOS table is malformed",
+            phosphor::logging::entry("OFFSET=%zu", error.offset),
+            phosphor::logging::entry("TYPE=%d", error.type),
+            phosphor::logging::entry("LENGTH=%d", error.length));
+        return snapshot;
     }
-    else
+
+    // Only the kinds of object built from structures that changed need to
+    // be looked at again.
+    if (inUse)
     {
-        if (length < sizeof(EntryPointStructure30))
+        TableDiff diff = diffTables(*inUse, *snapshot.table);
+        for (const StructureKey& key : diff.added)
         {
-            phosphor::logging::log<phosphor::logging::level::ERR>(
-                "Invalid entry point structure for SMBIOS 3.0");
-            return false;
+            snapshot.changedTypes.set(key.type);
+        }
+        for (const StructureKey& key : diff.removed)
+        {
+            snapshot.changedTypes.set(key.type);
+        }
+        for (const StructureChange& change : diff.changed)
+        {
+            snapshot.changedTypes.set(change.key.type);
         }
-
-        auto epStructure =
-            reinterpret_cast<const EntryPointStructure30*>(&dataIn[pos]);
-        foundMajorVersion = epStructure->smbiosVersion.majorVersion;
-        foundMinorVersion = epStructure->smbiosVersion.minorVersion;
     }
-    lg2::info("SMBIOS VERSION - {MAJOR}.{MINOR}", "MAJOR", foundMajorVersion,
-              "MINOR", foundMinorVersion);
-
-    auto itr = std::find_if(
-        std::begin(supportedSMBIOSVersions), std::end(supportedSMBIOSVersions),
-        [&](SMBIOSVersion versionItr) {
-            return versionItr.majorVersion == foundMajorVersion &&
-                   versionItr.minorVersion == foundMinorVersion;
-        });
-    if (itr == std::end(supportedSMBIOSVersions))
+    else
     {
-        return false;
+        snapshot.changedTypes.set();
     }
-    return true;
+
+    snapshot.index.build(*snapshot.table);
+    decodeColumns(snapshot.index, snapshot.memoryColumns);
+    snapshot.outcome = TableSnapshot::Outcome::loaded;
+    return snapshot;
 }
 
-bool MDR_V2::agentSynchronizeData()
+void MDR_V2::publishTable(TableSnapshot snapshot, uint64_t load)
 {
-    struct MDRSMBIOSHeader mdr2SMBIOS;
-    bool status = readDataFromFlash(&mdr2SMBIOS,
-                                    smbiosDir.dir[smbiosDirIndex].dataStorage);
-    if (!status)
+    if (load < publishedLoad)
     {
-        phosphor::logging::log<phosphor::logging::level::ERR>(
-            "agent data sync failed - read data from flash failed");
-        return false;
+        return;
     }
+    publishedLoad = load;
+    tableFileExists = snapshot.fileExists;
 
-    if (!checkSMBIOSVersion(smbiosDir.dir[smbiosDirIndex].dataStorage))
+    switch (snapshot.outcome)
     {
-        phosphor::logging::log<phosphor::logging::level::ERR>(
-            "Unsupported SMBIOS table version");
-        return false;
+        case TableSnapshot::Outcome::failed:
+            // A rejected table leaves the one in use, and the hash stored
+            // for it, in place. Without one the stored hash names a table
+            // from before the restart.
+            if (!tableHash)
+            {
+                unlink(mdrType2HashFile);
+            }
+            break;
+        case TableSnapshot::Outcome::unchanged:
+            markLoaded(snapshot.header);
+            storeTableHash();
+            break;
+        case TableSnapshot::Outcome::loaded:
+            // The previous table stays mapped until now, the inventory
+            // objects still point into it. Moving the file keeps its
+            // mapping, so the verified table stays valid.
+            tableFile = std::move(snapshot.file);
+            verifiedTable = snapshot.table;
+            tableHash = snapshot.hash;
+            smbiosDir.dir[smbiosDirIndex].dataStorage =
+                tableFile.data().data();
+            smbiosIndex = std::move(snapshot.index);
+            memoryColumns = std::move(snapshot.memoryColumns);
+            recordTypeReplies.clear();
+            tableGeneration++;
+            rawTable.reset();
+            systemInfoUpdate(snapshot.changedTypes);
+            markLoaded(snapshot.header);
+            storeTableHash();
+            smbiosInterface->signal_property("TableHash");
+            break;
     }
+}
 
-    systemInfoUpdate();
-    smbiosDir.dir[smbiosDirIndex].common.dataVersion = mdr2SMBIOS.dirVer;
-    smbiosDir.dir[smbiosDirIndex].common.timestamp = mdr2SMBIOS.timestamp;
-    smbiosDir.dir[smbiosDirIndex].common.size = mdr2SMBIOS.dataSize;
+void MDR_V2::markLoaded(const MDRSMBIOSHeader& header)
+{
+    smbiosDir.dir[smbiosDirIndex].common.dataVersion = header.dirVer;
+    smbiosDir.dir[smbiosDirIndex].common.timestamp = header.timestamp;
+    smbiosDir.dir[smbiosDirIndex].common.size = header.dataSize;
     smbiosDir.dir[smbiosDirIndex].stage = MDR2SMBIOSStatusEnum::mdr2Loaded;
     smbiosDir.dir[smbiosDirIndex].lock = MDR2DirLockEnum::mdr2DirUnlock;
+}
 
-    return true;
+void MDR_V2::storeTableHash()
+{
+    if (!phosphor::smbios::storeTableHash(mdrType2HashFile, *tableHash))
+    {
+        phosphor::logging::log<phosphor::logging::level::ERR>(
+            "Failed to store the SMBIOS table hash");
+    }
 }
 
 std::vector<uint32_t> MDR_V2::synchronizeDirectoryCommonData(uint8_t idIndex,
@@ -737,97 +807,182 @@ std::vector<uint32_t> MDR_V2::synchronizeDirectoryCommonData(uint8_t idIndex,
                 "Timer Error!");
             return;
         }
-        agentSynchronizeData();
+        startSync();
     });
     return result;
 }
 
-std::vector<boost::container::flat_map<std::string, RecordVariant>>
+const std::vector<boost::container::flat_map<std::string, RecordVariant>>&
     MDR_V2::getRecordType(size_t type)
 {
+    if (type > std::numeric_limits<uint8_t>::max())
+    {
+        throw std::invalid_argument("Invalid record type");
+    }
+    auto cached = recordTypeReplies.find(static_cast<uint8_t>(type));
+    if (cached != recordTypeReplies.end())
+    {
+        return cached->second;
+    }
 
     std::vector<boost::container::flat_map<std::string, RecordVariant>> ret;
-    if (type == memoryDeviceType)
+    bool known = visitTypeFields(type, [&](const auto& fields) {
+        if (smbiosIndex.data() == nullptr)
+        {
+            throw std::runtime_error("Data not populated");
+        }
+
+        for (Structure structure : smbiosIndex.structures(type))
+        {
+            boost::container::flat_map<std::string, RecordVariant>& record =
+                ret.emplace_back();
+            record.reserve(std::tuple_size_v<std::decay_t<decltype(fields)>>);
+            decodeFields(structure, fields,
+                         [&record](const auto& field, auto value) {
+                if constexpr (std::is_same_v<decltype(value), std::string_view>)
+                {
+                    record[field.name] = std::string(value);
+                }
+                else
+                {
+                    record[field.name] = value;
+                }
+            });
+        }
+    });
+    if (!known)
     {
+        throw std::invalid_argument("Invalid record type");
+    }
 
-        uint8_t* dataIn = smbiosDir.dir[smbiosDirIndex].dataStorage;
+    // Collectors poll the same types over and over; the reply stays valid
+    // until another table is published.
+    return recordTypeReplies.emplace(type, std::move(ret)).first->second;
+}
 
-        if (dataIn == nullptr)
+// Point the columns asking for the field at its name, and give them the
+// value a structure too short to hold the field reads as.
+template <typename Field>
+void matchColumns(const Field& field, const std::vector<std::string>& fields,
+                  std::vector<const char*>& names,
+                  std::vector<RecordVariant>& empty)
+{
+    for (size_t column = 0; column < fields.size(); column++)
+    {
+        if (fields[column] != field.name)
         {
-            throw std::runtime_error("Data not populated");
+            continue;
         }
+        names[column] = field.name;
+        if constexpr (Field::kind == FieldKind::string)
+        {
+            empty[column] = std::string();
+        }
+        else
+        {
+            empty[column] = typename Field::value_type{};
+        }
+    }
+}
 
-        do
+std::vector<std::vector<RecordVariant>>
+    MDR_V2::getRecordFields(size_t type, const std::vector<std::string>& fields)
+{
+    if (type > std::numeric_limits<uint8_t>::max())
+    {
+        throw std::invalid_argument("Invalid record type");
+    }
+
+    std::vector<std::vector<RecordVariant>> ret;
+    bool known = visitTypeFields(type, [&](const auto& descriptors) {
+        // Descriptor names are matched once; decoding then compares
+        // pointers.
+        std::vector<const char*> names(fields.size(), nullptr);
+        std::vector<RecordVariant> empty(fields.size());
+        std::apply(
+            [&](const auto&... field) {
+                (matchColumns(field, fields, names, empty), ...);
+            },
+            descriptors);
+        for (const char* name : names)
         {
-            dataIn =
-                getSMBIOSTypePtr(dataIn, memoryDeviceType, sizeof(MemoryInfo));
-            if (dataIn == nullptr)
+            if (name == nullptr)
             {
-                break;
+                throw std::invalid_argument("Invalid field name");
             }
-            boost::container::flat_map<std::string, RecordVariant>& record =
-                ret.emplace_back();
+        }
 
-            auto memoryInfo = reinterpret_cast<MemoryInfo*>(dataIn);
-
-            record["Type"] = memoryInfo->type;
-            record["Length"] = memoryInfo->length;
-            record["Handle"] = uint16_t(memoryInfo->handle);
-            record["Physical Memory Array Handle"] =
-                uint16_t(memoryInfo->phyArrayHandle);
-            record["Memory Error Information Handle"] =
-                uint16_t(memoryInfo->errInfoHandle);
-            record["Total Width"] = uint16_t(memoryInfo->totalWidth);
-            record["Data Width"] = uint16_t(memoryInfo->dataWidth);
-            record["Size"] = uint16_t(memoryInfo->size);
-            record["Form Factor"] = memoryInfo->formFactor;
-            record["Device Set"] = memoryInfo->deviceSet;
-            record["Device Locator"] = positionToString(
-                memoryInfo->deviceLocator, memoryInfo->length, dataIn);
-            record["Bank Locator"] = positionToString(
-                memoryInfo->bankLocator, memoryInfo->length, dataIn);
-            record["Memory Type"] = memoryInfo->memoryType;
-            record["Type Detail"] = uint16_t(memoryInfo->typeDetail);
-            record["Speed"] = uint16_t(memoryInfo->speed);
-            record["Manufacturer"] = positionToString(
-                memoryInfo->manufacturer, memoryInfo->length, dataIn);
-            record["Serial Number"] = positionToString(
-                memoryInfo->serialNum, memoryInfo->length, dataIn);
-            record["Asset Tag"] = positionToString(memoryInfo->assetTag,
-                                                   memoryInfo->length, dataIn);
-            record["Part Number"] = positionToString(
-                memoryInfo->partNum, memoryInfo->length, dataIn);
-            record["Attributes"] = memoryInfo->attributes;
-            record["Extended Size"] = uint32_t(memoryInfo->extendedSize);
-            record["Configured Memory Speed"] =
-                uint32_t(memoryInfo->confClockSpeed);
-            record["Minimum voltage"] = uint16_t(memoryInfo->minimumVoltage);
-            record["Maximum voltage"] = uint16_t(memoryInfo->maximumVoltage);
-            record["Configured voltage"] =
-                uint16_t(memoryInfo->configuredVoltage);
-            record["Memory Technology"] = memoryInfo->memoryTechnology;
-            record["Memory Operating Mode Capabilty"] =
-                uint16_t(memoryInfo->memoryOperatingModeCap);
-            record["Firmare Version"] = memoryInfo->firwareVersion;
-            record["Module Manufacturer ID"] =
-                uint16_t(memoryInfo->modelManufId);
-            record["Module Product ID"] = uint16_t(memoryInfo->modelProdId);
-            record["Memory Subsystem Controller Manufacturer ID"] =
-                uint16_t(memoryInfo->memSubConManufId);
-            record["Memory Subsystem Controller Product Id"] =
-                uint16_t(memoryInfo->memSubConProdId);
-            record["Non-volatile Size"] = uint64_t(memoryInfo->nvSize);
-            record["Volatile Size"] = uint64_t(memoryInfo->volatileSize);
-            record["Cache Size"] = uint64_t(memoryInfo->cacheSize);
-            record["Logical Size"] = uint64_t(memoryInfo->logicalSize);
-        } while ((dataIn = smbiosNextPtr(dataIn)) != nullptr);
+        if (smbiosIndex.data() == nullptr)
+        {
+            throw std::runtime_error("Data not populated");
+        }
 
-        return ret;
+        for (Structure structure : smbiosIndex.structures(type))
+        {
+            std::vector<RecordVariant>& row = ret.emplace_back(empty);
+            decodeFields(structure, descriptors,
+                         [&](const auto& field, auto value) {
+                for (size_t column = 0; column < names.size(); column++)
+                {
+                    if (names[column] != field.name)
+                    {
+                        continue;
+                    }
+                    if constexpr (std::is_same_v<decltype(value),
+                                                 std::string_view>)
+                    {
+                        row[column] = std::string(value);
+                    }
+                    else
+                    {
+                        row[column] = value;
+                    }
+                }
+            });
+        }
+    });
+    if (!known)
+    {
+        throw std::invalid_argument("Invalid record type");
     }
 
-    throw std::invalid_argument("Invalid record type");
     return ret;
 }
 
+sdbusplus::message::unix_fd MDR_V2::getRawTable()
+{
+    if (!verifiedTable)
+    {
+        throw std::runtime_error("Data not populated");
+    }
+
+    if (!rawTable)
+    {
+        rawTable = SealedTable::create(tableGeneration, verifiedTable->data(),
+                                       verifiedTable->size());
+        if (!rawTable)
+        {
+            phosphor::logging::log<phosphor::logging::level::ERR>(
+                "Failed to export the SMBIOS table",
+                phosphor::logging::entry("ERRNO=%d", errno));
+            throw std::runtime_error("Failed to export the table");
+        }
+    }
+    // The reply carries a duplicate; the memfd stays open for later calls.
+    return sdbusplus::message::unix_fd(rawTable->fd());
+}
+
+MemorySummary MDR_V2::getMemorySummary()
+{
+    if (smbiosIndex.data() == nullptr)
+    {
+        throw std::runtime_error("Data not populated");
+    }
+
+    return {memoryColumns.totalSizeKiB(),
+            static_cast<uint32_t>(memoryColumns.populated()),
+            memoryColumns.countBySpeed()};
+}
+
 } // namespace smbios
 } // namespace phosphor
@@ -14,6 +14,7 @@
 // limitations under the License.
 */
 
+#include "mdr_main.hpp"
 #include "mdrv2.hpp"
 
 #include <boost/asio/io_context.hpp>
@@ -22,26 +23,36 @@
 #include <sdbusplus/asio/connection.hpp>
 #include <sdbusplus/asio/object_server.hpp>
 
-boost::asio::io_context io;
-auto connection = std::make_shared<sdbusplus::asio::connection>(io);
-auto objServer = sdbusplus::asio::object_server(connection);
+#include <memory>
+
+// Created by runMdrV2, so that serving MDR V1 never connects a second bus.
+static std::unique_ptr<sdbusplus::asio::object_server> objServer;
 
 sdbusplus::asio::object_server& getObjectServer(void)
 {
-    return objServer;
+    return *objServer;
 }
 
-int main(void)
+int phosphor::smbios::runMdrV2(void)
 {
-    sdbusplus::bus_t& bus = static_cast<sdbusplus::bus_t&>(*connection);
-    sdbusplus::server::manager_t objManager(bus,
-                                            "/xyz/openbmc_project/inventory");
+    boost::asio::io_context io;
+    auto connection = std::make_shared<sdbusplus::asio::connection>(io);
+    objServer = std::make_unique<sdbusplus::asio::object_server>(connection);
+
+    {
+        sdbusplus::bus_t& bus = static_cast<sdbusplus::bus_t&>(*connection);
+        sdbusplus::server::manager_t objManager(
+            bus, "/xyz/openbmc_project/inventory");
 
-    bus.request_name("xyz.openbmc_project.Smbios.MDR_V2");
+        phosphor::smbios::MDR_V2 mdrV2(bus, phosphor::smbios::mdrV2Path, io);
 
-    phosphor::smbios::MDR_V2 mdrV2(bus, phosphor::smbios::mdrV2Path, io);
+        // Only take the name once the objects and their properties are
+        // there, so no client sees the service half built.
+        bus.request_name("xyz.openbmc_project.Smbios.MDR_V2");
 
-    io.run();
+        io.run();
+    }
 
+    objServer.reset();
     return 0;
 }
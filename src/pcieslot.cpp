@@ -10,33 +10,21 @@ namespace smbios
 
 void Pcie::pcieInfoUpdate()
 {
-    uint8_t* dataIn = getSMBIOSTypePtr(storage, systemSlots);
-
-    if (dataIn == nullptr)
+    // Also cleared when the motherboard is not known (any more).
+    std::vector<std::tuple<std::string, std::string, std::string>> assocs;
+    if (!motherboardPath.empty())
     {
-        return;
+        assocs.emplace_back("chassis", "pcie_slots", motherboardPath);
     }
+    association::associations(assocs, skipSignal);
 
-    /* offset 5 points to the slot type */
-    for (uint8_t index = 0;
-         index < pcieNum ||
-         pcieSmbiosType.find(*(dataIn + 5)) == pcieSmbiosType.end();)
+    auto slots = smbiosIndex.structures(systemSlots) |
+                 std::views::filter(isPcieSlot) | std::views::drop(pcieNum);
+    if (slots.begin() == slots.end())
     {
-        dataIn = smbiosNextPtr(dataIn);
-        if (dataIn == nullptr)
-        {
-            return;
-        }
-        dataIn = getSMBIOSTypePtr(dataIn, systemSlots);
-        if (dataIn == nullptr)
-        {
-            return;
-        }
-        if (pcieSmbiosType.find(*(dataIn + 5)) != pcieSmbiosType.end())
-        {
-            index++;
-        }
+        return;
     }
+    uint8_t* dataIn = (*slots.begin()).data();
 
     auto pcieInfo = reinterpret_cast<struct SystemSlotInfo*>(dataIn);
 
@@ -44,17 +32,10 @@ void Pcie::pcieInfoUpdate()
     pcieType(pcieInfo->slotType);
     pcieLaneSize(pcieInfo->slotDataBusWidth);
     pcieIsHotPluggable(pcieInfo->characteristics2);
-    pcieLocation(pcieInfo->slotDesignation, pcieInfo->length, dataIn);
+    pcieLocation(SmbiosStrings(dataIn)[pcieInfo->slotDesignation]);
 
     /* Pcie slot is embedded on the board. Always be true */
-    Item::present(true);
-
-    if (!motherboardPath.empty())
-    {
-        std::vector<std::tuple<std::string, std::string, std::string>> assocs;
-        assocs.emplace_back("chassis", "pcie_slots", motherboardPath);
-        association::associations(assocs);
-    }
+    Item::present(true, skipSignal);
 }
 
 void Pcie::pcieGeneration(const uint8_t type)
@@ -63,11 +44,11 @@ void Pcie::pcieGeneration(const uint8_t type)
         pcieGenerationTable.find(type);
     if (it == pcieGenerationTable.end())
     {
-        PCIeSlot::generation(PCIeGeneration::Unknown);
+        PCIeSlot::generation(PCIeGeneration::Unknown, skipSignal);
     }
     else
     {
-        PCIeSlot::generation(it->second);
+        PCIeSlot::generation(it->second, skipSignal);
     }
 }
 
@@ -76,11 +57,11 @@ void Pcie::pcieType(const uint8_t type)
     std::map<uint8_t, PCIeType>::const_iterator it = pcieTypeTable.find(type);
     if (it == pcieTypeTable.end())
     {
-        PCIeSlot::slotType(PCIeType::Unknown);
+        PCIeSlot::slotType(PCIeType::Unknown, skipSignal);
     }
     else
     {
-        PCIeSlot::slotType(it->second);
+        PCIeSlot::slotType(it->second, skipSignal);
     }
 }
 
@@ -89,11 +70,11 @@ void Pcie::pcieLaneSize(const uint8_t width)
     std::map<uint8_t, size_t>::const_iterator it = pcieLanesTable.find(width);
     if (it == pcieLanesTable.end())
     {
-        PCIeSlot::lanes(0);
+        PCIeSlot::lanes(0, skipSignal);
     }
     else
     {
-        PCIeSlot::lanes(it->second);
+        PCIeSlot::lanes(it->second, skipSignal);
     }
 }
 
@@ -102,14 +83,12 @@ void Pcie::pcieIsHotPluggable(const uint8_t characteristics)
     /*  Bit 1 of slot characteristics 2 indicates if slot supports hot-plug
      *  devices
      */
-    PCIeSlot::hotPluggable(characteristics & 0x2);
+    PCIeSlot::hotPluggable(characteristics & 0x2, skipSignal);
 }
 
-void Pcie::pcieLocation(const uint8_t slotDesignation, const uint8_t structLen,
-                        uint8_t* dataIn)
+void Pcie::pcieLocation(std::string_view slotDesignation)
 {
-    location::locationCode(
-        positionToString(slotDesignation, structLen, dataIn));
+    location::locationCode(std::string(slotDesignation), skipSignal);
 }
 
 } // namespace smbios
@@ -1,7 +1,7 @@
 #include "handler.hpp"
 
 #include "mdrv2.hpp"
-#include "smbios_mdrv2.hpp"
+#include "smbios_hash.hpp"
 
 #include <sys/stat.h>
 #include <unistd.h>
@@ -13,10 +13,13 @@
 #include <sdbusplus/message.hpp>
 
 #include <algorithm>
+#include <cerrno>
+#include <cstdio>
 #include <cstdint>
 #include <ctime>
 #include <fstream>
 #include <memory>
+#include <optional>
 #include <string>
 #include <vector>
 
@@ -62,6 +65,22 @@ bool syncSmbiosData()
     return true;
 }
 
+/* Whether the daemon is already using the table in the region data. It
+ * stores the hash of its table next to the table file, and removes it
+ * while the file holds anything else.
+ */
+bool tableInUse(const std::vector<uint8_t>& region)
+{
+    std::optional<phosphor::smbios::TableHash> hash =
+        phosphor::smbios::hashRegionTable(region.data(), region.size());
+    if (!hash)
+    {
+        return false;
+    }
+    return phosphor::smbios::tableFileInUse(mdrType2File, mdrType2HashFile,
+                                            *hash);
+}
+
 } // namespace internal
 
 bool SmbiosBlobHandler::canHandleBlob(const std::string& path)
@@ -190,6 +209,17 @@ bool SmbiosBlobHandler::commit(uint16_t session,
     /* Clear the commit_error bit. */
     blobPtr->state &= ~blobs::StateFlags::commit_error;
 
+    /* Hosts mostly send the same table on every boot. Leave the file and the
+     * daemon alone then.
+     */
+    if (internal::tableInUse(blobPtr->buffer))
+    {
+        phosphor::logging::log<phosphor::logging::level::INFO>(
+            "SMBIOS table unchanged, skipping sync");
+        blobPtr->state |= blobs::StateFlags::committed;
+        return true;
+    }
+
     MDRSMBIOSHeader mdrHdr;
     mdrHdr.mdrType = mdrTypeII;
     mdrHdr.timestamp = std::time(nullptr);
@@ -206,7 +236,11 @@ bool SmbiosBlobHandler::commit(uint16_t session,
         }
     }
 
-    std::ofstream smbiosFile(mdrType2File,
+    /* The daemon maps the table file, so write the new one beside it and
+     * rename it into place rather than rewriting the mapped file.
+     */
+    std::string tempFile = std::string(mdrType2File) + ".tmp";
+    std::ofstream smbiosFile(tempFile,
                              std::ios_base::binary | std::ios_base::trunc);
     if (!smbiosFile.good())
     {
@@ -223,16 +257,28 @@ bool SmbiosBlobHandler::commit(uint16_t session,
                          sizeof(MDRSMBIOSHeader));
         smbiosFile.write(reinterpret_cast<char*>(blobPtr->buffer.data()),
                          mdrHdr.dataSize);
-        blobPtr->state |= blobs::StateFlags::committing;
+        smbiosFile.close();
     }
     catch (const std::ofstream::failure& e)
     {
         phosphor::logging::log<phosphor::logging::level::ERR>(
             "Write data from flash error - write data error",
             phosphor::logging::entry("ERROR=%s", e.what()));
+        unlink(tempFile.c_str());
+        blobPtr->state |= blobs::StateFlags::commit_error;
+        return false;
+    }
+
+    if (rename(tempFile.c_str(), mdrType2File) != 0)
+    {
+        phosphor::logging::log<phosphor::logging::level::ERR>(
+            "Write data from flash error - replace SMBIOS table file failure",
+            phosphor::logging::entry("ERRNO=%d", errno));
+        unlink(tempFile.c_str());
         blobPtr->state |= blobs::StateFlags::commit_error;
         return false;
     }
+    blobPtr->state |= blobs::StateFlags::committing;
 
     if (!internal::syncSmbiosData())
     {
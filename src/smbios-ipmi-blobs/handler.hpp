@@ -29,9 +29,6 @@ class SmbiosBlobHandler : public GenericBlobInterface
             {
                 state |= blobs::StateFlags::open_write;
             }
-
-            /* Pre-allocate the buffer.capacity() with maxBufferSize */
-            buffer.reserve(maxBufferSize);
         }
 
         /* The blob handler session id. */
@@ -67,8 +64,11 @@ class SmbiosBlobHandler : public GenericBlobInterface
   private:
     static constexpr char blobId[] = "/smbios";
 
-    /* SMBIOS table storage size */
-    static constexpr uint32_t maxBufferSize = 64 * 1024;
+    /* SMBIOS table storage size, the size of the MDR shared memory region.
+     * The staging buffer grows with the data written instead of being
+     * reserved up front.
+     */
+    static constexpr uint32_t maxBufferSize = 1024 * 1024;
 
     /* The handler only allows one open blob. */
     std::unique_ptr<SmbiosBlob> blobPtr = nullptr;
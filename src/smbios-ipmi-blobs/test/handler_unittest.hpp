@@ -25,6 +25,6 @@ class SmbiosBlobHandlerTest : public ::testing::Test
     const uint16_t session = 0;
     const std::string expectedBlobId = "/smbios";
     const std::vector<std::string> expectedBlobIdList = {"/smbios"};
-    const uint32_t handlerMaxBufferSize = 64 * 1024;
+    const uint32_t handlerMaxBufferSize = 1024 * 1024;
 };
 } // namespace blobs
@@ -0,0 +1,145 @@
+#include "smbios_diff.hpp"
+
+#include "smbios_fields.hpp"
+
+#include <cstring>
+#include <tuple>
+#include <unordered_map>
+
+namespace phosphor
+{
+
+namespace smbios
+{
+
+namespace
+{
+
+/* A structure with the bytes it spans, string set included. */
+struct Span
+{
+    Structure structure;
+    size_t size;
+    bool matched;
+};
+
+std::vector<Span> spans(const VerifiedTable& verified)
+{
+    const uint8_t* end = verified.data() + verified.size();
+    std::vector<Span> result;
+    for (Structure structure : verified.table().structures())
+    {
+        uint8_t* next = smbiosNextPtr(structure.data(), end);
+        result.push_back(Span{
+            structure, static_cast<size_t>(next - structure.data()), false});
+    }
+    return result;
+}
+
+uint32_t keyOf(const Structure& structure)
+{
+    return static_cast<uint32_t>(structure.type()) << 16 | structure.handle();
+}
+
+StructureKey structureKey(const Structure& structure)
+{
+    return StructureKey{structure.type(), structure.handle()};
+}
+
+template <typename F>
+bool fieldDiffers(const F& field, const Structure& before,
+                  const SmbiosStrings& beforeStrings, const Structure& after,
+                  const SmbiosStrings& afterStrings)
+{
+    auto oldValue = field.read(before);
+    auto newValue = field.read(after);
+    if (!oldValue || !newValue)
+    {
+        return oldValue.has_value() != newValue.has_value();
+    }
+    if constexpr (F::kind == FieldKind::string)
+    {
+        return beforeStrings[*oldValue] != afterStrings[*newValue];
+    }
+    else
+    {
+        return *oldValue != *newValue;
+    }
+}
+
+std::vector<std::string_view> changedFields(const Structure& before,
+                                            const Structure& after)
+{
+    std::vector<std::string_view> fields;
+    visitTypeFields(after.type(), [&](const auto& descriptors) {
+        SmbiosStrings beforeStrings = before.strings();
+        SmbiosStrings afterStrings = after.strings();
+        std::apply(
+            [&](const auto&... field) {
+                ((fieldDiffers(field, before, beforeStrings, after,
+                               afterStrings)
+                      ? fields.push_back(field.name)
+                      : void()),
+                 ...);
+            },
+            descriptors);
+    });
+    return fields;
+}
+
+} // namespace
+
+TableDiff diffTables(const VerifiedTable& previous,
+                     const VerifiedTable& current)
+{
+    TableDiff diff;
+    if (previous.size() == current.size() &&
+        std::memcmp(previous.data(), current.data(), current.size()) == 0)
+    {
+        return diff;
+    }
+
+    std::vector<Span> before = spans(previous);
+    // The first structure wins if firmware repeats a handle, as in
+    // SmbiosIndex; later repeats count as added or removed.
+    std::unordered_map<uint32_t, size_t> byKey;
+    byKey.reserve(before.size());
+    for (size_t index = 0; index < before.size(); index++)
+    {
+        byKey.emplace(keyOf(before[index].structure), index);
+    }
+
+    for (const Span& after : spans(current))
+    {
+        auto it = byKey.find(keyOf(after.structure));
+        if (it == byKey.end() || before[it->second].matched)
+        {
+            diff.added.push_back(structureKey(after.structure));
+            continue;
+        }
+        Span& match = before[it->second];
+        match.matched = true;
+        if (match.size == after.size &&
+            std::memcmp(match.structure.data(), after.structure.data(),
+                        after.size) == 0)
+        {
+            continue;
+        }
+        diff.changed.push_back(
+            StructureChange{structureKey(after.structure),
+                            changedFields(match.structure, after.structure)});
+    }
+
+    for (const Span& span : before)
+    {
+        if (!span.matched)
+        {
+            diff.removed.push_back(structureKey(span.structure));
+        }
+    }
+    return diff;
+}
+
+} // namespace smbios
+
+} // namespace phosphor
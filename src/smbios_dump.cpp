@@ -0,0 +1,234 @@
+#include "smbios_dump.hpp"
+
+#include "smbios_entry_point.hpp"
+#include "smbios_fields.hpp"
+#include "smbios_table.hpp"
+
+#include <charconv>
+#include <cstring>
+#include <type_traits>
+
+namespace phosphor
+{
+
+namespace smbios
+{
+
+namespace dump
+{
+
+namespace
+{
+
+/* Every structure is decoded as far as its length allows. */
+constexpr LengthRequirements noRequirements{};
+
+template <typename T>
+void appendNumber(std::string& out, T value)
+{
+    char buffer[24];
+    auto result = std::to_chars(std::begin(buffer), std::end(buffer), value);
+    out.append(buffer, result.ptr);
+}
+
+/* Firmware strings are not guaranteed to be UTF-8, so every byte outside
+ * printable ASCII is escaped as the code point of the same value.
+ */
+void appendJsonString(std::string& out, std::string_view value)
+{
+    constexpr char hex[] = "0123456789abcdef";
+
+    out += '"';
+    for (char c : value)
+    {
+        auto byte = static_cast<unsigned char>(c);
+        if (byte == '"' || byte == '\\')
+        {
+            out += '\\';
+            out += c;
+        }
+        else if (byte < 0x20 || byte >= 0x7f)
+        {
+            out.append("\\u00");
+            out += hex[byte >> 4];
+            out += hex[byte & 0xf];
+        }
+        else
+        {
+            out += c;
+        }
+    }
+    out += '"';
+}
+
+void appendCsvField(std::string& out, std::string_view value)
+{
+    if (value.find_first_of(",\"\r\n") == std::string_view::npos)
+    {
+        out.append(value);
+        return;
+    }
+    out += '"';
+    for (char c : value)
+    {
+        if (c == '"')
+        {
+            out += '"';
+        }
+        out += c;
+    }
+    out += '"';
+}
+
+template <typename Value>
+void appendValue(std::string& out, Format format, Value value)
+{
+    if constexpr (std::is_same_v<Value, std::string_view>)
+    {
+        if (format == Format::json)
+        {
+            appendJsonString(out, value);
+        }
+        else
+        {
+            appendCsvField(out, value);
+        }
+    }
+    else
+    {
+        appendNumber(out, value);
+    }
+}
+
+void appendJson(std::string& out, std::string_view name,
+                const TableLocation& location, const Table& table)
+{
+    out.append("{\"file\":");
+    appendJsonString(out, name);
+    out.append(",\"version\":");
+    if (location.version)
+    {
+        out += '"';
+        appendNumber(out, location.version->majorVersion);
+        out += '.';
+        appendNumber(out, location.version->minorVersion);
+        out += '"';
+    }
+    else
+    {
+        out.append("null");
+    }
+    out.append(",\"structures\":[");
+
+    bool firstStructure = true;
+    for (Structure structure : table.structures())
+    {
+        visitTypeFields(structure.type(), [&](const auto& fields) {
+            out.append(firstStructure ? "{" : ",{");
+            firstStructure = false;
+            bool firstField = true;
+            decodeFields(structure, fields, [&](const auto& field, auto value) {
+                out.append(firstField ? "\"" : ",\"");
+                firstField = false;
+                out.append(field.name);
+                out.append("\":");
+                appendValue(out, Format::json, value);
+            });
+            out += '}';
+        });
+    }
+    out.append("]}\n");
+}
+
+void appendCsv(std::string& out, std::string_view name, const Table& table)
+{
+    for (Structure structure : table.structures())
+    {
+        visitTypeFields(structure.type(), [&](const auto& fields) {
+            decodeFields(structure, fields, [&](const auto& field, auto value) {
+                // Type and handle have columns of their own.
+                if (field.offset < structureHeaderLen)
+                {
+                    return;
+                }
+                appendCsvField(out, name);
+                out += ',';
+                appendNumber(out, structure.type());
+                out += ',';
+                appendNumber(out, structure.handle());
+                out += ',';
+                appendCsvField(out, field.name);
+                out += ',';
+                appendValue(out, Format::csv, value);
+                out += '\n';
+            });
+        });
+    }
+}
+
+} // namespace
+
+TableLocation locateTable(const uint8_t* data, size_t size)
+{
+    TableLocation location{0, size, std::nullopt};
+
+    MDRSMBIOSHeader header;
+    if (size >= sizeof(header))
+    {
+        std::memcpy(&header, data, sizeof(header));
+        if (header.mdrType == mdrTypeII &&
+            header.dataSize <= size - sizeof(header))
+        {
+            location.offset = sizeof(header);
+            location.size = header.dataSize;
+        }
+    }
+
+    std::optional<EntryPoint> entryPoint = findEntryPoint(
+        data + location.offset, location.size, mdr2SMBaseAddress);
+    if (entryPoint)
+    {
+        location.offset += entryPoint->tableOffset;
+        location.size = entryPoint->tableSize;
+        location.version = entryPoint->version;
+    }
+    return location;
+}
+
+void appendCsvHeader(std::string& out)
+{
+    out.append("file,type,handle,field,value\n");
+}
+
+bool dumpTable(std::string_view name, std::vector<uint8_t>& data,
+               Format format, std::string& out, std::string& error)
+{
+    TableLocation location = locateTable(data.data(), data.size());
+
+    VerifyError verifyError{};
+    std::optional<VerifiedTable> verified =
+        VerifiedTable::verify(data.data() + location.offset, location.size,
+                              noRequirements, &verifyError);
+    if (!verified)
+    {
+        error = "malformed structure at table offset " +
+                std::to_string(verifyError.offset);
+        return false;
+    }
+
+    if (format == Format::json)
+    {
+        appendJson(out, name, location, verified->table());
+    }
+    else
+    {
+        appendCsv(out, name, verified->table());
+    }
+    return true;
+}
+
+} // namespace dump
+
+} // namespace smbios
+
+} // namespace phosphor
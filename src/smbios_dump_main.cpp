@@ -0,0 +1,198 @@
+#include "smbios_dump.hpp"
+
+#include <getopt.h>
+
+#include <algorithm>
+#include <atomic>
+#include <cstdio>
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <system_error>
+#include <thread>
+#include <vector>
+
+using namespace phosphor::smbios;
+
+namespace
+{
+
+/* Files decoded before their output is written, bounding memory use when
+ * a directory holds many thousands of tables.
+ */
+constexpr size_t batchSize = 1024;
+
+struct Result
+{
+    std::string out;
+    std::string error;
+};
+
+void usage(const char* name)
+{
+    std::fprintf(stderr,
+                 "Usage: %s [-f json|csv] [-j jobs] path...\n"
+                 "Decode SMBIOS tables stored by the MDR daemons, region "
+                 "copies\nor raw tables. Directories are searched "
+                 "recursively.\n\n"
+                 "  -f  output format, json (default) or csv\n"
+                 "  -j  files decoded in parallel, 0 for one per CPU\n",
+                 name);
+}
+
+bool readFile(const std::string& path, std::vector<uint8_t>& data)
+{
+    std::ifstream file(path, std::ios_base::binary | std::ios_base::ate);
+    if (!file.good())
+    {
+        return false;
+    }
+    data.resize(static_cast<size_t>(file.tellg()));
+    file.seekg(0, std::ios_base::beg);
+    file.read(reinterpret_cast<char*>(data.data()), data.size());
+    return file.good() || data.empty();
+}
+
+void dumpFile(const std::string& path, dump::Format format,
+              std::vector<uint8_t>& data, Result& result)
+{
+    result.out.clear();
+    result.error.clear();
+    if (!readFile(path, data))
+    {
+        result.error = "cannot read file";
+        return;
+    }
+    dump::dumpTable(path, data, format, result.out, result.error);
+}
+
+bool collectFiles(const std::string& path, std::vector<std::string>& files)
+{
+    std::error_code ec;
+    if (!std::filesystem::is_directory(path, ec))
+    {
+        files.push_back(path);
+        return true;
+    }
+
+    std::vector<std::string> found;
+    for (std::filesystem::recursive_directory_iterator it(path, ec), end;
+         !ec && it != end; it.increment(ec))
+    {
+        if (it->is_regular_file(ec))
+        {
+            found.push_back(it->path().string());
+        }
+    }
+    if (ec)
+    {
+        std::fprintf(stderr, "%s: %s\n", path.c_str(), ec.message().c_str());
+        return false;
+    }
+    std::sort(found.begin(), found.end());
+    files.insert(files.end(), found.begin(), found.end());
+    return true;
+}
+
+} // namespace
+
+int main(int argc, char* argv[])
+{
+    dump::Format format = dump::Format::json;
+    unsigned jobs = 1;
+
+    int opt;
+    while ((opt = getopt(argc, argv, "f:j:h")) != -1)
+    {
+        switch (opt)
+        {
+            case 'f':
+                if (std::string(optarg) == "json")
+                {
+                    format = dump::Format::json;
+                }
+                else if (std::string(optarg) == "csv")
+                {
+                    format = dump::Format::csv;
+                }
+                else
+                {
+                    usage(argv[0]);
+                    return EXIT_FAILURE;
+                }
+                break;
+            case 'j':
+                jobs = static_cast<unsigned>(std::strtoul(optarg, nullptr, 0));
+                if (jobs == 0)
+                {
+                    jobs = std::max(1U, std::thread::hardware_concurrency());
+                }
+                break;
+            default:
+                usage(argv[0]);
+                return opt == 'h' ? EXIT_SUCCESS : EXIT_FAILURE;
+        }
+    }
+    if (optind >= argc)
+    {
+        usage(argv[0]);
+        return EXIT_FAILURE;
+    }
+
+    bool failed = false;
+    std::vector<std::string> files;
+    for (int index = optind; index < argc; index++)
+    {
+        failed |= !collectFiles(argv[index], files);
+    }
+
+    if (format == dump::Format::csv)
+    {
+        std::string header;
+        dump::appendCsvHeader(header);
+        std::fwrite(header.data(), 1, header.size(), stdout);
+    }
+
+    // Output keeps the order of the files however the work is split.
+    std::vector<Result> results(std::min(batchSize, files.size()));
+    for (size_t begin = 0; begin < files.size(); begin += batchSize)
+    {
+        size_t count = std::min(batchSize, files.size() - begin);
+        std::atomic<size_t> next = 0;
+        auto worker = [&]() {
+            std::vector<uint8_t> data;
+            for (size_t index; (index = next++) < count;)
+            {
+                dumpFile(files[begin + index], format, data, results[index]);
+            }
+        };
+
+        std::vector<std::thread> threads;
+        for (unsigned thread = 1; thread < std::min<size_t>(jobs, count);
+             thread++)
+        {
+            threads.emplace_back(worker);
+        }
+        worker();
+        for (std::thread& thread : threads)
+        {
+            thread.join();
+        }
+
+        for (size_t index = 0; index < count; index++)
+        {
+            const Result& result = results[index];
+            if (!result.error.empty())
+            {
+                std::fprintf(stderr, "%s: %s\n", files[begin + index].c_str(),
+                             result.error.c_str());
+                failed = true;
+                continue;
+            }
+            std::fwrite(result.out.data(), 1, result.out.size(), stdout);
+        }
+    }
+
+    return failed ? EXIT_FAILURE : EXIT_SUCCESS;
+}
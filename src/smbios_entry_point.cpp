@@ -0,0 +1,173 @@
+#include "smbios_entry_point.hpp"
+
+#include <algorithm>
+#include <cstring>
+
+namespace phosphor
+{
+
+namespace smbios
+{
+
+namespace internal
+{
+
+namespace
+{
+
+constexpr size_t anchorAlignment = 16;
+constexpr char anchorString21[] = "_SM_";
+constexpr char anchorString30[] = "_SM3_";
+constexpr char intermediateAnchorString[] = "_DMI_";
+constexpr size_t intermediateOffset =
+    offsetof(EntryPointStructure21, intermediateAnchorString);
+constexpr size_t intermediateLength =
+    sizeof(EntryPointStructure21) - intermediateOffset;
+
+bool checksumValid(const uint8_t* data, size_t length)
+{
+    uint8_t sum = 0;
+    for (size_t index = 0; index < length; index++)
+    {
+        sum += data[index];
+    }
+    return sum == 0;
+}
+
+/* Map the table address from the entry point to an offset in the data. The
+ * data is either a copy of the host region starting at baseAddress, or
+ * holds the table at the address taken as an offset. An offset outside the
+ * data, or inside the entry point itself, is rejected.
+ */
+std::optional<size_t> tableOffset(const EntryPoint& entry, uint64_t address,
+                                  size_t size, uint64_t baseAddress)
+{
+    auto usable = [&](uint64_t offset) {
+        return offset < size &&
+               (offset < entry.offset || offset >= entry.offset + entry.length);
+    };
+    if (address >= baseAddress && usable(address - baseAddress))
+    {
+        return static_cast<size_t>(address - baseAddress);
+    }
+    if (usable(address))
+    {
+        return static_cast<size_t>(address);
+    }
+    return std::nullopt;
+}
+
+void locateTable(EntryPoint& entry, uint64_t address, size_t size,
+                 uint64_t baseAddress)
+{
+    std::optional<size_t> offset =
+        tableOffset(entry, address, size, baseAddress);
+    if (!offset)
+    {
+        // The address means nothing in this copy; the table sits next to
+        // the entry point, in front of it if there is room.
+        offset = entry.offset > 0 ? 0 : entry.length;
+    }
+    entry.tableOffset = *offset;
+    size_t end = *offset < entry.offset ? entry.offset : size;
+    entry.tableSize = std::min(entry.tableSize, end - *offset);
+}
+
+std::optional<EntryPoint> parseEntryPoint30(const uint8_t* data,
+                                            size_t offset, size_t size,
+                                            uint64_t baseAddress)
+{
+    if (size - offset < sizeof(EntryPointStructure30))
+    {
+        return std::nullopt;
+    }
+    EntryPointStructure30 ep;
+    std::memcpy(&ep, data + offset, sizeof(ep));
+    if (ep.epLength < sizeof(EntryPointStructure30) ||
+        ep.epLength > size - offset ||
+        !checksumValid(data + offset, ep.epLength))
+    {
+        return std::nullopt;
+    }
+
+    EntryPoint entry{ep.smbiosVersion, offset, ep.epLength, 0,
+                     ep.structTableMaxSize};
+    locateTable(entry, ep.structTableAddr, size, baseAddress);
+    return entry;
+}
+
+std::optional<EntryPoint> parseEntryPoint21(const uint8_t* data,
+                                            size_t offset, size_t size,
+                                            uint64_t baseAddress)
+{
+    if (size - offset < sizeof(EntryPointStructure21))
+    {
+        return std::nullopt;
+    }
+    EntryPointStructure21 ep;
+    std::memcpy(&ep, data + offset, sizeof(ep));
+    // Some firmware reports 0x1e for the 0x1f byte structure.
+    if (ep.epLength < sizeof(EntryPointStructure21) - 1 ||
+        ep.epLength > size - offset ||
+        !checksumValid(data + offset, ep.epLength) ||
+        std::memcmp(ep.intermediateAnchorString, intermediateAnchorString,
+                    sizeof(ep.intermediateAnchorString)) != 0 ||
+        !checksumValid(data + offset + intermediateOffset, intermediateLength))
+    {
+        return std::nullopt;
+    }
+
+    EntryPoint entry{ep.smbiosVersion, offset, ep.epLength, 0,
+                     ep.structTableLength};
+    locateTable(entry, ep.structTableAddress, size, baseAddress);
+    return entry;
+}
+
+} // namespace
+
+} // namespace internal
+
+std::optional<EntryPoint> findEntryPoint(const uint8_t* data, size_t size,
+                                         uint64_t baseAddress)
+{
+    using namespace internal;
+
+    if (data == nullptr)
+    {
+        return std::nullopt;
+    }
+
+    std::optional<EntryPoint> entry21;
+    for (size_t offset = 0; size - offset >= sizeof(anchorString21) - 1;
+         offset += anchorAlignment)
+    {
+        const uint8_t* anchor = data + offset;
+        size_t remaining = size - offset;
+        if (remaining >= sizeof(anchorString30) - 1 &&
+            std::memcmp(anchor, anchorString30,
+                        sizeof(anchorString30) - 1) == 0)
+        {
+            std::optional<EntryPoint> entry30 =
+                parseEntryPoint30(data, offset, size, baseAddress);
+            if (entry30)
+            {
+                return entry30;
+            }
+        }
+        else if (!entry21 && std::memcmp(anchor, anchorString21,
+                                         sizeof(anchorString21) - 1) == 0)
+        {
+            entry21 = parseEntryPoint21(data, offset, size, baseAddress);
+        }
+
+        if (remaining <= anchorAlignment)
+        {
+            break;
+        }
+    }
+    return entry21;
+}
+
+} // namespace smbios
+
+} // namespace phosphor
@@ -0,0 +1,198 @@
+#include "smbios_hash.hpp"
+
+#include "smbios_entry_point.hpp"
+
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <bit>
+#include <cerrno>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+
+namespace phosphor
+{
+
+namespace smbios
+{
+
+namespace
+{
+
+/* FIPS 180-4 round constants. */
+constexpr std::array<uint32_t, 64> roundConstants = {
+    0x428a2f98, 0x71374491, 0xb5c0fbcf, 0xe9b5dba5, 0x3956c25b, 0x59f111f1,
+    0x923f82a4, 0xab1c5ed5, 0xd807aa98, 0x12835b01, 0x243185be, 0x550c7dc3,
+    0x72be5d74, 0x80deb1fe, 0x9bdc06a7, 0xc19bf174, 0xe49b69c1, 0xefbe4786,
+    0x0fc19dc6, 0x240ca1cc, 0x2de92c6f, 0x4a7484aa, 0x5cb0a9dc, 0x76f988da,
+    0x983e5152, 0xa831c66d, 0xb00327c8, 0xbf597fc7, 0xc6e00bf3, 0xd5a79147,
+    0x06ca6351, 0x14292967, 0x27b70a85, 0x2e1b2138, 0x4d2c6dfc, 0x53380d13,
+    0x650a7354, 0x766a0abb, 0x81c2c92e, 0x92722c85, 0xa2bfe8a1, 0xa81a664b,
+    0xc24b8b70, 0xc76c51a3, 0xd192e819, 0xd6990624, 0xf40e3585, 0x106aa070,
+    0x19a4c116, 0x1e376c08, 0x2748774c, 0x34b0bcb5, 0x391c0cb3, 0x4ed8aa4a,
+    0x5b9cca4f, 0x682e6ff3, 0x748f82ee, 0x78a5636f, 0x84c87814, 0x8cc70208,
+    0x90befffa, 0xa4506ceb, 0xbef9a3f7, 0xc67178f2};
+
+constexpr size_t blockSize = 64;
+
+void compress(std::array<uint32_t, 8>& state, const uint8_t* block)
+{
+    std::array<uint32_t, 64> schedule;
+    for (size_t index = 0; index < 16; index++)
+    {
+        const uint8_t* word = block + index * 4;
+        schedule[index] = static_cast<uint32_t>(word[0]) << 24 |
+                          static_cast<uint32_t>(word[1]) << 16 |
+                          static_cast<uint32_t>(word[2]) << 8 | word[3];
+    }
+    for (size_t index = 16; index < 64; index++)
+    {
+        uint32_t w15 = schedule[index - 15];
+        uint32_t w2 = schedule[index - 2];
+        uint32_t s0 = std::rotr(w15, 7) ^ std::rotr(w15, 18) ^ (w15 >> 3);
+        uint32_t s1 = std::rotr(w2, 17) ^ std::rotr(w2, 19) ^ (w2 >> 10);
+        schedule[index] = schedule[index - 16] + s0 + schedule[index - 7] + s1;
+    }
+
+    uint32_t a = state[0], b = state[1], c = state[2], d = state[3];
+    uint32_t e = state[4], f = state[5], g = state[6], h = state[7];
+    for (size_t index = 0; index < 64; index++)
+    {
+        uint32_t s1 = std::rotr(e, 6) ^ std::rotr(e, 11) ^ std::rotr(e, 25);
+        uint32_t choice = (e & f) ^ (~e & g);
+        uint32_t t1 = h + s1 + choice + roundConstants[index] + schedule[index];
+        uint32_t s0 = std::rotr(a, 2) ^ std::rotr(a, 13) ^ std::rotr(a, 22);
+        uint32_t majority = (a & b) ^ (a & c) ^ (b & c);
+        uint32_t t2 = s0 + majority;
+        h = g;
+        g = f;
+        f = e;
+        e = d + t1;
+        d = c;
+        c = b;
+        b = a;
+        a = t1 + t2;
+    }
+
+    state[0] += a;
+    state[1] += b;
+    state[2] += c;
+    state[3] += d;
+    state[4] += e;
+    state[5] += f;
+    state[6] += g;
+    state[7] += h;
+}
+
+} // namespace
+
+TableHash sha256(const uint8_t* data, size_t size)
+{
+    std::array<uint32_t, 8> state = {0x6a09e667, 0xbb67ae85, 0x3c6ef372,
+                                     0xa54ff53a, 0x510e527f, 0x9b05688c,
+                                     0x1f83d9ab, 0x5be0cd19};
+
+    size_t whole = size - size % blockSize;
+    for (size_t offset = 0; offset < whole; offset += blockSize)
+    {
+        compress(state, data + offset);
+    }
+
+    // The tail, a 0x80 byte, zeros and the length in bits fill one or two
+    // more blocks.
+    std::array<uint8_t, blockSize * 2> tail{};
+    size_t remaining = size - whole;
+    if (remaining != 0)
+    {
+        std::memcpy(tail.data(), data + whole, remaining);
+    }
+    tail[remaining] = 0x80;
+    size_t tailSize = remaining + 9 <= blockSize ? blockSize : blockSize * 2;
+    uint64_t bits = static_cast<uint64_t>(size) * 8;
+    for (size_t index = 0; index < 8; index++)
+    {
+        tail[tailSize - 1 - index] = static_cast<uint8_t>(bits >> (index * 8));
+    }
+    for (size_t offset = 0; offset < tailSize; offset += blockSize)
+    {
+        compress(state, tail.data() + offset);
+    }
+
+    TableHash hash;
+    for (size_t index = 0; index < state.size(); index++)
+    {
+        hash[index * 4] = static_cast<uint8_t>(state[index] >> 24);
+        hash[index * 4 + 1] = static_cast<uint8_t>(state[index] >> 16);
+        hash[index * 4 + 2] = static_cast<uint8_t>(state[index] >> 8);
+        hash[index * 4 + 3] = static_cast<uint8_t>(state[index]);
+    }
+    return hash;
+}
+
+std::string toHex(const TableHash& hash)
+{
+    constexpr char hex[] = "0123456789abcdef";
+
+    std::string result;
+    result.reserve(hash.size() * 2);
+    for (uint8_t byte : hash)
+    {
+        result += hex[byte >> 4];
+        result += hex[byte & 0xf];
+    }
+    return result;
+}
+
+std::optional<TableHash> hashRegionTable(const uint8_t* region, size_t size)
+{
+    std::optional<EntryPoint> entryPoint =
+        findEntryPoint(region, size, mdr2SMBaseAddress);
+    if (!entryPoint)
+    {
+        return std::nullopt;
+    }
+    return sha256(region + entryPoint->tableOffset, entryPoint->tableSize);
+}
+
+bool storeTableHash(const char* hashFile, const TableHash& hash)
+{
+    std::string tempFile = std::string(hashFile) + ".tmp";
+    std::ofstream file(tempFile, std::ios_base::trunc);
+    file << toHex(hash);
+    file.close();
+    if (!file.good() || std::rename(tempFile.c_str(), hashFile) != 0)
+    {
+        std::remove(tempFile.c_str());
+        return false;
+    }
+    return true;
+}
+
+bool tableFileInUse(const char* tableFile, const char* hashFile,
+                    const TableHash& hash)
+{
+    struct stat status;
+    if (stat(tableFile, &status) != 0)
+    {
+        return false;
+    }
+
+    std::ifstream file(hashFile);
+    std::string stored;
+    file >> stored;
+    return stored == toHex(hash);
+}
+
+bool removeTableFile(const char* tableFile, const char* hashFile)
+{
+    if (unlink(hashFile) != 0 && errno != ENOENT)
+    {
+        return false;
+    }
+    return unlink(tableFile) == 0 || errno == ENOENT;
+}
+
+} // namespace smbios
+
+} // namespace phosphor
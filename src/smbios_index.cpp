@@ -0,0 +1,26 @@
+#include "smbios_index.hpp"
+
+namespace phosphor
+{
+
+namespace smbios
+{
+
+void SmbiosIndex::build(const VerifiedTable& verified)
+{
+    clear();
+    table = verified.data();
+
+    for (Structure structure : verified.table().structures())
+    {
+        uint32_t offset = static_cast<uint32_t>(structure.data() - table);
+        structureOffsets.push_back(offset);
+        typeOffsets[structure.type()].push_back(offset);
+        // The first structure wins if firmware repeats a handle.
+        handleOffsets.emplace(structure.handle(), offset);
+    }
+}
+
+} // namespace smbios
+
+} // namespace phosphor
@@ -0,0 +1,35 @@
+#include "mdr_main.hpp"
+
+#include <cstdio>
+#include <cstdlib>
+#include <string_view>
+
+static void usage(const char* name)
+{
+    std::fprintf(stderr,
+                 "Usage: %s --mdrv1|--mdrv2\n"
+                 "Serve the SMBIOS table over the given MDR protocol.\n",
+                 name);
+}
+
+int main(int argc, char* argv[])
+{
+    if (argc != 2)
+    {
+        usage(argv[0]);
+        return EXIT_FAILURE;
+    }
+
+    std::string_view protocol(argv[1]);
+    if (protocol == "--mdrv1")
+    {
+        return phosphor::smbios::runMdrV1();
+    }
+    if (protocol == "--mdrv2")
+    {
+        return phosphor::smbios::runMdrV2();
+    }
+
+    usage(argv[0]);
+    return EXIT_FAILURE;
+}
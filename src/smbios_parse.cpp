@@ -0,0 +1,70 @@
+#include "smbios_parse.hpp"
+
+#include <algorithm>
+
+bool isSupportedSMBIOSVersion(const SMBIOSVersion& version)
+{
+    return std::any_of(std::begin(supportedSMBIOSVersions),
+                       std::end(supportedSMBIOSVersions),
+                       [&version](const SMBIOSVersion& supported) {
+        return supported.majorVersion == version.majorVersion &&
+               supported.minorVersion == version.minorVersion;
+    });
+}
+
+uint8_t* getSMBIOSTypePtr(uint8_t* smbiosDataIn, uint8_t typeId,
+                          const uint8_t* end, size_t size)
+{
+    uint8_t* smbiosData = smbiosDataIn;
+    while (smbiosData != nullptr && end - smbiosData >= separateLen &&
+           ((*smbiosData != '\0') || (*(smbiosData + 1) != '\0')))
+    {
+        uint8_t* next = smbiosNextPtr(smbiosData, end);
+        if (next == nullptr)
+        {
+            return nullptr;
+        }
+        if (*smbiosData != typeId)
+        {
+            smbiosData = next;
+            continue;
+        }
+        if (*(smbiosData + 1) < size)
+        {
+            return nullptr;
+        }
+        return smbiosData;
+    }
+    return nullptr;
+}
+
+std::string positionToString(uint8_t positionNum, uint8_t structLen,
+                             uint8_t* dataIn, const uint8_t* end)
+{
+    if (dataIn == nullptr || positionNum == 0 ||
+        end - dataIn < structLen + separateLen)
+    {
+        return "";
+    }
+    const uint8_t* strings = dataIn + structLen;
+    // Same bound as smbiosNextPtr: the terminator must end inside the table.
+    size_t count = static_cast<size_t>(end - strings) - 1;
+    size_t setEnd = phosphor::smbios::findStringSetEnd(strings, count);
+    if (setEnd >= count)
+    {
+        return "";
+    }
+
+    // Every string up to the terminator ends with a NUL at or before it.
+    const char* target = reinterpret_cast<const char*>(strings);
+    const char* last = target + setEnd;
+    for (uint8_t index = 1; index < positionNum && target < last; index++)
+    {
+        target += std::char_traits<char>::length(target) + 1;
+    }
+    if (target >= last)
+    {
+        return ""; // 0x00 0x00 means end of the entry.
+    }
+    return std::string(target);
+}
@@ -0,0 +1,218 @@
+#include "smbios_storage.hpp"
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <cerrno>
+#include <limits>
+#include <utility>
+
+namespace phosphor
+{
+
+namespace smbios
+{
+
+TableFile::~TableFile()
+{
+    unmap();
+}
+
+TableFile::TableFile(TableFile&& other) noexcept :
+    base(std::exchange(other.base, nullptr)),
+    mappedSize(std::exchange(other.mappedSize, 0)),
+    dataSize(std::exchange(other.dataSize, 0)), fileStatus(other.fileStatus)
+{}
+
+TableFile& TableFile::operator=(TableFile&& other) noexcept
+{
+    if (this != &other)
+    {
+        unmap();
+        base = std::exchange(other.base, nullptr);
+        mappedSize = std::exchange(other.mappedSize, 0);
+        dataSize = std::exchange(other.dataSize, 0);
+        fileStatus = other.fileStatus;
+    }
+    return *this;
+}
+
+void TableFile::unmap()
+{
+    if (base != nullptr)
+    {
+        munmap(base, mappedSize);
+        base = nullptr;
+    }
+}
+
+std::optional<TableFile> TableFile::load(const char* path,
+                                         size_t maxDataSize, LoadError* error)
+{
+    auto reject = [error](LoadError reason) -> std::optional<TableFile> {
+        if (error != nullptr)
+        {
+            *error = reason;
+        }
+        return std::nullopt;
+    };
+
+    int fd = open(path, O_RDONLY | O_CLOEXEC);
+    if (fd < 0)
+    {
+        return reject(LoadError::open);
+    }
+
+    TableFile file;
+    if (fstat(fd, &file.fileStatus) != 0)
+    {
+        close(fd);
+        return reject(LoadError::read);
+    }
+    size_t fileSize = static_cast<size_t>(file.fileStatus.st_size);
+    if (fileSize < sizeof(MDRSMBIOSHeader))
+    {
+        close(fd);
+        return reject(LoadError::tooSmall);
+    }
+
+    MDRSMBIOSHeader header;
+    if (pread(fd, &header, sizeof(header), 0) !=
+        static_cast<ssize_t>(sizeof(header)))
+    {
+        close(fd);
+        return reject(LoadError::tooSmall);
+    }
+    if (header.dataSize > maxDataSize)
+    {
+        close(fd);
+        return reject(LoadError::tooLarge);
+    }
+
+    // Copy only what the header claims, into memory no writer of the file
+    // can take away.
+    size_t copySize = sizeof(MDRSMBIOSHeader) +
+                      std::min<size_t>(header.dataSize,
+                                       fileSize - sizeof(MDRSMBIOSHeader));
+    void* address = mmap(nullptr, copySize, PROT_READ | PROT_WRITE,
+                         MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (address == MAP_FAILED)
+    {
+        close(fd);
+        return reject(LoadError::read);
+    }
+    file.base = static_cast<uint8_t*>(address);
+    file.mappedSize = copySize;
+
+    size_t copied = 0;
+    while (copied < copySize)
+    {
+        ssize_t count =
+            pread(fd, file.base + copied, copySize - copied, copied);
+        if (count < 0 && errno == EINTR)
+        {
+            continue;
+        }
+        if (count < 0)
+        {
+            int savedErrno = errno;
+            close(fd);
+            errno = savedErrno;
+            return reject(LoadError::read);
+        }
+        if (count == 0)
+        {
+            // Truncated while being read.
+            break;
+        }
+        copied += static_cast<size_t>(count);
+    }
+    close(fd);
+    mprotect(file.base, file.mappedSize, PROT_READ);
+
+    // The header may have been rewritten since it was first checked.
+    if (copied < sizeof(MDRSMBIOSHeader))
+    {
+        return reject(LoadError::tooSmall);
+    }
+    if (file.header().dataSize > maxDataSize)
+    {
+        return reject(LoadError::tooLarge);
+    }
+    file.dataSize = std::min<size_t>(file.header().dataSize,
+                                     copied - sizeof(MDRSMBIOSHeader));
+    return file;
+}
+
+SealedTable::~SealedTable()
+{
+    if (memfd >= 0)
+    {
+        close(memfd);
+    }
+}
+
+SealedTable::SealedTable(SealedTable&& other) noexcept :
+    memfd(std::exchange(other.memfd, -1))
+{}
+
+SealedTable& SealedTable::operator=(SealedTable&& other) noexcept
+{
+    if (this != &other)
+    {
+        if (memfd >= 0)
+        {
+            close(memfd);
+        }
+        memfd = std::exchange(other.memfd, -1);
+    }
+    return *this;
+}
+
+std::optional<SealedTable> SealedTable::create(uint64_t generation,
+                                               const uint8_t* table,
+                                               size_t size)
+{
+    if (size > std::numeric_limits<uint32_t>::max())
+    {
+        errno = EFBIG;
+        return std::nullopt;
+    }
+
+    SealedTable sealed;
+    sealed.memfd =
+        memfd_create("smbios-table", MFD_CLOEXEC | MFD_ALLOW_SEALING);
+    if (sealed.memfd < 0)
+    {
+        return std::nullopt;
+    }
+
+    RawTableHeader header{};
+    header.generation = generation;
+    header.tableOffset = sizeof(header);
+    header.tableSize = static_cast<uint32_t>(size);
+    if (ftruncate(sealed.memfd, sizeof(header) + size) != 0)
+    {
+        return std::nullopt;
+    }
+    if (pwrite(sealed.memfd, &header, sizeof(header), 0) !=
+            static_cast<ssize_t>(sizeof(header)) ||
+        pwrite(sealed.memfd, table, size, sizeof(header)) !=
+            static_cast<ssize_t>(size))
+    {
+        return std::nullopt;
+    }
+
+    if (fcntl(sealed.memfd, F_ADD_SEALS,
+              F_SEAL_SHRINK | F_SEAL_GROW | F_SEAL_WRITE | F_SEAL_SEAL) != 0)
+    {
+        return std::nullopt;
+    }
+    return sealed;
+}
+
+} // namespace smbios
+
+} // namespace phosphor
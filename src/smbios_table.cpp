@@ -0,0 +1,55 @@
+#include "smbios_table.hpp"
+
+namespace phosphor
+{
+
+namespace smbios
+{
+
+std::optional<VerifiedTable>
+    VerifiedTable::verify(uint8_t* begin, size_t size,
+                          const LengthRequirements& required,
+                          VerifyError* error)
+{
+    if (begin == nullptr)
+    {
+        return std::nullopt;
+    }
+
+    auto reject = [&](VerifyError::Reason reason, const uint8_t* dataIn) {
+        if (error != nullptr)
+        {
+            *error = {reason, static_cast<size_t>(dataIn - begin), *dataIn,
+                      *(dataIn + 1)};
+        }
+        return std::nullopt;
+    };
+
+    const uint8_t* end = begin + size;
+    uint8_t* dataIn = begin;
+    while (end - dataIn >= separateLen &&
+           ((*dataIn != '\0') || (*(dataIn + 1) != '\0')))
+    {
+        uint8_t* next = smbiosNextPtr(dataIn, end);
+        if (next == nullptr)
+        {
+            return reject(VerifyError::Reason::malformed, dataIn);
+        }
+        if (*(dataIn + 1) < required[*dataIn])
+        {
+            return reject(VerifyError::Reason::tooShort, dataIn);
+        }
+
+        bool last = *dataIn == endOfTableType;
+        dataIn = next;
+        if (last)
+        {
+            break;
+        }
+    }
+    return VerifiedTable(begin, static_cast<size_t>(dataIn - begin));
+}
+
+} // namespace smbios
+
+} // namespace phosphor
@@ -18,7 +18,7 @@
 
 #include "mdrv2.hpp"
 
-#include <fstream>
+#include <cerrno>
 #include <iomanip>
 #include <iostream>
 #include <sstream>
@@ -36,8 +36,7 @@ namespace smbios
 
 std::string System::uuid(std::string value)
 {
-    uint8_t* dataIn = storage;
-    dataIn = getSMBIOSTypePtr(dataIn, systemType);
+    uint8_t* dataIn = smbiosIndex.get(systemType, 0);
     if (dataIn != nullptr)
     {
         auto systemInfo = reinterpret_cast<struct SystemInfo*>(dataIn);
@@ -62,11 +61,11 @@ std::string System::uuid(std::string value)
         stream << std::setw(2) << static_cast<int>(systemInfo->uuid.node[5]);
 
         return sdbusplus::xyz::openbmc_project::Common::server::UUID::uuid(
-            stream.str());
+            stream.str(), skipSignal);
     }
 
     return sdbusplus::xyz::openbmc_project::Common::server::UUID::uuid(
-        "00000000-0000-0000-0000-000000000000");
+        "00000000-0000-0000-0000-000000000000", skipSignal);
 }
 
 static std::string getService(sdbusplus::bus_t& bus,
@@ -123,30 +122,27 @@ static void setProperty(sdbusplus::bus_t& bus, const std::string& objectPath,
 std::string System::version(std::string value)
 {
     std::string result = "No BIOS Version";
-    uint8_t* dataIn = storage;
-    dataIn = getSMBIOSTypePtr(dataIn, biosType);
+    uint8_t* dataIn = smbiosIndex.get(biosType, 0);
     if (dataIn != nullptr)
     {
         auto biosInfo = reinterpret_cast<struct BIOSInfo*>(dataIn);
-        uint8_t biosVerByte = biosInfo->biosVersion;
-        std::string tempS =
-            positionToString(biosInfo->biosVersion, biosInfo->length, dataIn);
+        std::string_view tempS = SmbiosStrings(dataIn)[biosInfo->biosVersion];
         if (std::find_if(tempS.begin(), tempS.end(),
                          [](char ch) { return !isprint(ch); }) != tempS.end())
         {
-            std::ofstream smbiosFile(mdrType2File, std::ios_base::trunc);
-            if (!smbiosFile.good())
+            // Unlinked rather than truncated: the table is still mapped.
+            // Its hash goes too, or an upload of the same bytes would be
+            // taken for the table in use and never written again.
+            if (!removeTableFile(mdrType2File, mdrType2HashFile))
             {
                 phosphor::logging::log<phosphor::logging::level::ERR>(
-                    "Open MDRV2 table file failure");
+                    "Remove MDRV2 table file failure");
                 return result;
             }
-            smbiosFile.clear();
-            smbiosFile.close();
             phosphor::logging::log<phosphor::logging::level::ERR>(
                 "Find non-print char, delete the broken MDRV2 table file!");
             return sdbusplus::xyz::openbmc_project::Inventory::Decorator::
-                server::Revision::version(result);
+                server::Revision::version(result, skipSignal);
         }
         result = tempS;
 
@@ -156,7 +152,7 @@ std::string System::version(std::string value)
     lg2::info("VERSION INFO - BIOS - {VER}", "VER", result);
 
     return sdbusplus::xyz::openbmc_project::Inventory::Decorator::server::
-        Revision::version(result);
+        Revision::version(result, skipSignal);
 }
 
 } // namespace smbios
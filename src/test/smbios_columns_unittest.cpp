@@ -0,0 +1,161 @@
+#include "smbios_columns.hpp"
+#include "smbios_index.hpp"
+#include "smbios_table.hpp"
+#include "smbios_unittest.hpp"
+
+#include <cstdint>
+#include <cstring>
+#include <optional>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+namespace phosphor
+{
+namespace smbios
+{
+
+class SmbiosColumnsTest : public SmbiosTableTest
+{
+  protected:
+    /* Append a structure of the given length with fields patched in. */
+    template <typename... Fields>
+    void addRecord(uint8_t type, uint16_t handle, uint8_t length,
+                   Fields... fields)
+    {
+        std::vector<uint8_t> formatted(length, 0);
+        formatted[0] = type;
+        formatted[1] = length;
+        std::memcpy(formatted.data() + 2, &handle, sizeof(handle));
+        (patch(formatted, fields), ...);
+        table.insert(table.end(), formatted.begin(), formatted.end());
+        table.insert(table.end(), {0, 0});
+    }
+
+    template <typename T>
+    struct Field
+    {
+        size_t offset;
+        T value;
+    };
+
+    template <typename T>
+    static void patch(std::vector<uint8_t>& formatted, Field<T> field)
+    {
+        std::memcpy(formatted.data() + field.offset, &field.value,
+                    sizeof(T));
+    }
+
+    const SmbiosIndex& build()
+    {
+        endTable();
+        std::optional<VerifiedTable> verified =
+            VerifiedTable::verify(table.data(), table.size(), {});
+        EXPECT_TRUE(verified);
+        index.build(*verified);
+        return index;
+    }
+
+    SmbiosIndex index;
+};
+
+TEST_F(SmbiosColumnsTest, DecodesMemorySizes)
+{
+    addRecord(memoryDeviceType, 0x1100, 0x54, Field<uint16_t>{0x0c, 0x4000},
+              Field<uint16_t>{0x15, 3200});
+    addRecord(memoryDeviceType, 0x1101, 0x54, Field<uint16_t>{0x0c, 0x8200});
+    addRecord(memoryDeviceType, 0x1102, 0x54, Field<uint16_t>{0x0c, 0x7fff},
+              Field<uint32_t>{0x1c, 0x80040000}, Field<uint16_t>{0x15, 4800});
+    addRecord(memoryDeviceType, 0x1103, 0x54, Field<uint16_t>{0x0c, 0});
+    addRecord(memoryDeviceType, 0x1104, 0x54, Field<uint16_t>{0x0c, 0xffff});
+    MemoryColumns memory;
+
+    decodeColumns(build(), memory);
+
+    ASSERT_EQ(memory.size(), 5);
+    EXPECT_EQ(memory.handle[2], 0x1102);
+    EXPECT_EQ(memory.sizeKiB[0], 16 * 1024 * 1024);
+    EXPECT_EQ(memory.sizeKiB[1], 512);
+    EXPECT_EQ(memory.sizeKiB[2], 256ull * 1024 * 1024);
+    EXPECT_EQ(memory.sizeKiB[3], 0);
+    EXPECT_EQ(memory.sizeKiB[4], 0);
+    EXPECT_EQ(memory.speed[2], 4800);
+}
+
+TEST_F(SmbiosColumnsTest, AggregatesPopulatedDevices)
+{
+    for (uint16_t dimm = 0; dimm < 8; dimm++)
+    {
+        uint16_t size = dimm < 6 ? 0x8400 : 0;
+        uint16_t speed = dimm < 2 ? 2933 : 3200;
+        addRecord(memoryDeviceType, 0x1100 + dimm, 0x54,
+                  Field<uint16_t>{0x0c, size}, Field<uint16_t>{0x15, speed});
+    }
+    addRecord(processorsType, 0x0400, 0x30);
+    MemoryColumns memory;
+
+    decodeColumns(build(), memory);
+
+    EXPECT_EQ(memory.size(), 8);
+    EXPECT_EQ(memory.totalSizeKiB(), 6 * 1024);
+    EXPECT_EQ(memory.populated(), 6);
+    auto bySpeed = memory.countBySpeed();
+    ASSERT_EQ(bySpeed.size(), 2);
+    EXPECT_EQ(bySpeed[2933], 2);
+    EXPECT_EQ(bySpeed[3200], 4);
+}
+
+TEST_F(SmbiosColumnsTest, DecodesProcessorCounts)
+{
+    addRecord(processorsType, 0x0400, 0x30, Field<uint8_t>{0x06, 0xb3},
+              Field<uint8_t>{0x18, 0x41}, Field<uint8_t>{0x23, 28},
+              Field<uint8_t>{0x25, 56});
+    addRecord(processorsType, 0x0401, 0x30, Field<uint8_t>{0x06, 0xfe},
+              Field<uint8_t>{0x18, 0x41}, Field<uint8_t>{0x23, 0xff},
+              Field<uint8_t>{0x25, 0xff}, Field<uint16_t>{0x28, 0x101},
+              Field<uint16_t>{0x2a, 300}, Field<uint16_t>{0x2e, 600});
+    addRecord(processorsType, 0x0402, 0x30, Field<uint8_t>{0x23, 28});
+    ProcessorColumns processors;
+
+    decodeColumns(build(), processors);
+
+    ASSERT_EQ(processors.size(), 3);
+    EXPECT_EQ(processors.family[0], 0xb3);
+    EXPECT_EQ(processors.family[1], 0x101);
+    EXPECT_EQ(processors.coreCount[1], 300);
+    EXPECT_FALSE(processors.populated[2]);
+    EXPECT_EQ(processors.totalCores(), 328);
+    EXPECT_EQ(processors.totalThreads(), 656);
+}
+
+TEST_F(SmbiosColumnsTest, DecodesSlotUsage)
+{
+    addRecord(systemSlots, 0x0900, 0x11, Field<uint8_t>{0x05, 0xb6},
+              Field<uint8_t>{0x07, 0x04});
+    addRecord(systemSlots, 0x0901, 0x11, Field<uint8_t>{0x05, 0xa5},
+              Field<uint8_t>{0x07, 0x03});
+    SlotColumns slots;
+
+    decodeColumns(build(), slots);
+
+    ASSERT_EQ(slots.size(), 2);
+    EXPECT_EQ(slots.slotType[1], 0xa5);
+    EXPECT_EQ(slots.inUse(), 1);
+}
+
+TEST_F(SmbiosColumnsTest, ShortRecordsDecodeMissingFieldsAsZero)
+{
+    addRecord(memoryDeviceType, 0x1100, 0x17, Field<uint16_t>{0x0c, 0x7fff},
+              Field<uint16_t>{0x15, 1600});
+    MemoryColumns memory;
+
+    decodeColumns(build(), memory);
+
+    ASSERT_EQ(memory.size(), 1);
+    EXPECT_EQ(memory.speed[0], 1600);
+    EXPECT_EQ(memory.configuredSpeed[0], 0);
+    EXPECT_EQ(memory.sizeKiB[0], 0);
+}
+
+} // namespace smbios
+} // namespace phosphor
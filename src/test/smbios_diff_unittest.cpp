@@ -0,0 +1,117 @@
+#include "smbios_diff.hpp"
+#include "smbios_unittest.hpp"
+
+#include <cstdint>
+#include <optional>
+#include <string_view>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+namespace phosphor
+{
+namespace smbios
+{
+
+class SmbiosDiffTest : public SmbiosTableTest
+{
+  protected:
+    /* Keep the table built so far as the previous generation and start
+     * building the next one.
+     */
+    void nextGeneration()
+    {
+        previous.swap(table);
+        table.clear();
+    }
+
+    TableDiff diff()
+    {
+        constexpr LengthRequirements noRequirements{};
+        std::optional<VerifiedTable> before = VerifiedTable::verify(
+            previous.data(), previous.size(), noRequirements);
+        std::optional<VerifiedTable> after =
+            VerifiedTable::verify(table.data(), table.size(), noRequirements);
+        EXPECT_TRUE(before && after);
+        return diffTables(*before, *after);
+    }
+
+    /* The memory device at 0x1100, up to its part number. */
+    void addDimm(uint8_t size, const std::string& serial)
+    {
+        addStructure(memoryDeviceType, 0x1100,
+                     {0, 0x10, 0, 0, 0x48, 0, 0x40, 0, size, 0, 9, 0, 1, 2,
+                      26, 0x80, 0, 0, 0, 3, 4, 5, 6},
+                     {"DIMM_A1", "NODE 0", "Vendor", serial, "Tag", "Part"});
+    }
+
+    std::vector<uint8_t> previous;
+};
+
+TEST_F(SmbiosDiffTest, IdenticalTablesHaveNoChanges)
+{
+    addStructure(systemType, 0x0100, {1, 2}, {"Intel", "S2600WFT"});
+    endTable();
+    nextGeneration();
+    addStructure(systemType, 0x0100, {1, 2}, {"Intel", "S2600WFT"});
+    endTable();
+
+    EXPECT_TRUE(diff().empty());
+}
+
+TEST_F(SmbiosDiffTest, ReportsChangedFields)
+{
+    addStructure(systemType, 0x0100, {1, 2}, {"Intel", "S2600WFT"});
+    addDimm(0x40, "0001");
+    endTable();
+    nextGeneration();
+    addStructure(systemType, 0x0100, {1, 2}, {"Intel", "S2600WFT"});
+    addDimm(0x80, "0002");
+    endTable();
+
+    TableDiff result = diff();
+    EXPECT_TRUE(result.added.empty());
+    EXPECT_TRUE(result.removed.empty());
+    ASSERT_EQ(result.changed.size(), 1);
+    EXPECT_EQ(result.changed[0].key, (StructureKey{memoryDeviceType, 0x1100}));
+    EXPECT_EQ(result.changed[0].fields,
+              (std::vector<std::string_view>{"Size", "Serial Number"}));
+}
+
+TEST_F(SmbiosDiffTest, ComparesStringsByContent)
+{
+    // Same strings, listed in another order.
+    addStructure(systemType, 0x0100, {1, 2}, {"Intel", "S2600WFT"});
+    endTable();
+    nextGeneration();
+    addStructure(systemType, 0x0100, {2, 1}, {"S2600WFT", "Intel"});
+    endTable();
+
+    TableDiff result = diff();
+    ASSERT_EQ(result.changed.size(), 1);
+    EXPECT_TRUE(result.changed[0].fields.empty());
+}
+
+TEST_F(SmbiosDiffTest, ReportsAddedAndRemoved)
+{
+    addStructure(processorsType, 0x0400, {1}, {"CPU0"});
+    addStructure(processorsType, 0x0401, {1}, {"CPU1"});
+    endTable();
+    nextGeneration();
+    addStructure(processorsType, 0x0400, {1}, {"CPU0"});
+    addStructure(processorsType, 0x0402, {1}, {"CPU2"});
+    // A handle reused for another type is not the same structure.
+    addStructure(systemSlots, 0x0401, {1}, {"SLOT1"});
+    endTable();
+
+    TableDiff result = diff();
+    EXPECT_EQ(result.added,
+              (std::vector<StructureKey>{{processorsType, 0x0402},
+                                         {systemSlots, 0x0401}}));
+    EXPECT_EQ(result.removed,
+              (std::vector<StructureKey>{{processorsType, 0x0401}}));
+    EXPECT_TRUE(result.changed.empty());
+}
+
+} // namespace smbios
+} // namespace phosphor
@@ -0,0 +1,128 @@
+#include "smbios_dump.hpp"
+#include "smbios_unittest.hpp"
+
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+namespace phosphor
+{
+namespace smbios
+{
+
+class SmbiosDumpTest : public SmbiosTableTest
+{
+  protected:
+    /* The file SmbiosBlobHandler::commit writes for a region holding a
+     * 3.3 entry point at 0 and the table at 0x20.
+     */
+    std::vector<uint8_t> mdrFile()
+    {
+        constexpr size_t tableOffset = 0x20;
+
+        EntryPointStructure30 ep{};
+        std::memcpy(ep.anchorString, "_SM3_", sizeof(ep.anchorString));
+        ep.epLength = sizeof(ep);
+        ep.smbiosVersion = {3, 3};
+        ep.epRevision = 1;
+        ep.structTableMaxSize = static_cast<uint32_t>(table.size());
+        ep.structTableAddr = mdr2SMBaseAddress + tableOffset;
+        auto bytes = reinterpret_cast<uint8_t*>(&ep);
+        uint8_t sum = 0;
+        for (size_t index = 0; index < sizeof(ep); index++)
+        {
+            sum += bytes[index];
+        }
+        ep.epChecksum = static_cast<uint8_t>(-sum);
+
+        std::vector<uint8_t> region(tableOffset, 0);
+        std::memcpy(region.data(), &ep, sizeof(ep));
+        region.insert(region.end(), table.begin(), table.end());
+
+        MDRSMBIOSHeader header{};
+        header.mdrType = mdrTypeII;
+        header.dataSize = static_cast<uint32_t>(region.size());
+        std::vector<uint8_t> file(sizeof(header));
+        std::memcpy(file.data(), &header, sizeof(header));
+        file.insert(file.end(), region.begin(), region.end());
+        return file;
+    }
+
+    std::string out;
+    std::string error;
+};
+
+TEST_F(SmbiosDumpTest, BareTableAsJson)
+{
+    addStructure(systemType, 0x0100, {1, 2}, {"Intel", "S2600WFT"});
+    addStructure(baseboardType, 0x0200, {1}, {"Intel"});
+    endTable();
+
+    ASSERT_TRUE(dump::dumpTable("host1", table, dump::Format::json, out,
+                                error));
+    EXPECT_EQ(out, "{\"file\":\"host1\",\"version\":null,\"structures\":["
+                   "{\"Type\":1,\"Length\":6,\"Handle\":256,"
+                   "\"Manufacturer\":\"Intel\",\"Product Name\":\"S2600WFT\"},"
+                   "{\"Type\":2,\"Length\":5,\"Handle\":512,"
+                   "\"Manufacturer\":\"Intel\"}"
+                   "]}\n");
+}
+
+TEST_F(SmbiosDumpTest, LocatesTableInMdrFile)
+{
+    addStructure(memoryDeviceType, 0x1100, {0, 0, 0, 0});
+    endTable();
+    std::vector<uint8_t> file = mdrFile();
+
+    dump::TableLocation location = dump::locateTable(file.data(), file.size());
+    EXPECT_EQ(location.offset, sizeof(MDRSMBIOSHeader) + 0x20);
+    EXPECT_EQ(location.size, table.size());
+    ASSERT_TRUE(location.version);
+    EXPECT_EQ(location.version->majorVersion, 3);
+    EXPECT_EQ(location.version->minorVersion, 3);
+
+    ASSERT_TRUE(
+        dump::dumpTable("smbios2", file, dump::Format::json, out, error));
+    EXPECT_NE(out.find("\"version\":\"3.3\""), std::string::npos);
+    EXPECT_NE(out.find("\"Handle\":4352"), std::string::npos);
+}
+
+TEST_F(SmbiosDumpTest, CsvHasOneRowPerField)
+{
+    addStructure(systemType, 0x0100, {1, 2}, {"Intel, Corp.", "S2600\"WF\""});
+    endTable();
+
+    ASSERT_TRUE(dump::dumpTable("host1", table, dump::Format::csv, out, error));
+    EXPECT_EQ(out, "host1,1,256,Manufacturer,\"Intel, Corp.\"\n"
+                   "host1,1,256,Product Name,\"S2600\"\"WF\"\"\"\n");
+}
+
+TEST_F(SmbiosDumpTest, EscapesJsonStrings)
+{
+    addStructure(systemType, 0x0100, {1}, {"A\"\\\t\x80"});
+    endTable();
+
+    ASSERT_TRUE(dump::dumpTable("host1", table, dump::Format::json, out,
+                                error));
+    EXPECT_NE(out.find("\"Manufacturer\":\"A\\\"\\\\\\u0009\\u0080\""),
+              std::string::npos);
+}
+
+TEST_F(SmbiosDumpTest, RejectsMalformedTable)
+{
+    addStructure(systemType, 0x0100, {1}, {"Intel"});
+    addStructure(systemType, 0x0101, {1}, {"Intel"});
+    table.resize(table.size() - 3);
+    out = "previous\n";
+
+    EXPECT_FALSE(dump::dumpTable("host1", table, dump::Format::json, out,
+                                 error));
+    EXPECT_EQ(out, "previous\n");
+    EXPECT_FALSE(error.empty());
+}
+
+} // namespace smbios
+} // namespace phosphor
@@ -0,0 +1,178 @@
+#include "smbios_entry_point.hpp"
+#include "smbios_unittest.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+namespace phosphor
+{
+namespace smbios
+{
+
+class SmbiosEntryPointTest : public SmbiosTableTest
+{
+  protected:
+    static uint8_t checksum(const uint8_t* data, size_t length)
+    {
+        uint8_t sum = 0;
+        for (size_t index = 0; index < length; index++)
+        {
+            sum += data[index];
+        }
+        return static_cast<uint8_t>(-sum);
+    }
+
+    /* Place an entry point at offset, growing the data if needed. */
+    template <typename EntryPointStructure>
+    void placeEntryPoint(std::vector<uint8_t>& data, size_t offset,
+                         EntryPointStructure ep)
+    {
+        ep.epLength = sizeof(ep);
+        ep.epChecksum = 0;
+        auto bytes = reinterpret_cast<uint8_t*>(&ep);
+        if constexpr (std::is_same_v<EntryPointStructure,
+                                     EntryPointStructure21>)
+        {
+            std::memcpy(ep.intermediateAnchorString, "_DMI_", 5);
+            ep.intermediateChecksum = 0;
+            ep.intermediateChecksum =
+                checksum(bytes + 0x10, sizeof(ep) - 0x10);
+        }
+        ep.epChecksum = checksum(bytes, sizeof(ep));
+        if (data.size() < offset + sizeof(ep))
+        {
+            data.resize(offset + sizeof(ep), 0);
+        }
+        std::memcpy(data.data() + offset, &ep, sizeof(ep));
+    }
+
+    static EntryPointStructure30 entryPoint30(uint64_t address,
+                                              uint32_t maxSize)
+    {
+        EntryPointStructure30 ep{};
+        std::memcpy(ep.anchorString, "_SM3_", 5);
+        ep.smbiosVersion = {3, 3};
+        ep.epRevision = 1;
+        ep.structTableMaxSize = maxSize;
+        ep.structTableAddr = address;
+        return ep;
+    }
+
+    static EntryPointStructure21 entryPoint21(uint32_t address,
+                                              uint16_t length)
+    {
+        EntryPointStructure21 ep{};
+        std::memcpy(&ep.anchorString, "_SM_", 4);
+        ep.smbiosVersion = {2, 8};
+        ep.structTableLength = length;
+        ep.structTableAddress = address;
+        return ep;
+    }
+};
+
+TEST_F(SmbiosEntryPointTest, NoAnchorFindsNothing)
+{
+    addStructure(processorsType, 0x0400, {1}, {"CPU0"});
+    endTable();
+
+    EXPECT_FALSE(findEntryPoint(table.data(), table.size()));
+    EXPECT_FALSE(findEntryPoint(nullptr, 0));
+}
+
+TEST_F(SmbiosEntryPointTest, LocatesTableAfterEntryPoint30ByAddress)
+{
+    std::vector<uint8_t> data;
+    addStructure(processorsType, 0x0400, {1}, {"CPU0"});
+    endTable(0);
+    placeEntryPoint(data, 0, entryPoint30(0x20, table.size()));
+    data.resize(0x20, 0);
+    data.insert(data.end(), table.begin(), table.end());
+
+    auto entryPoint = findEntryPoint(data.data(), data.size());
+
+    ASSERT_TRUE(entryPoint);
+    EXPECT_EQ(entryPoint->version.majorVersion, 3);
+    EXPECT_EQ(entryPoint->version.minorVersion, 3);
+    EXPECT_EQ(entryPoint->offset, 0);
+    EXPECT_EQ(entryPoint->tableOffset, 0x20);
+    EXPECT_EQ(entryPoint->tableSize, table.size());
+}
+
+TEST_F(SmbiosEntryPointTest, MapsHostAddressThroughBaseAddress)
+{
+    constexpr uint64_t base = 0x9ff00000;
+    addStructure(processorsType, 0x0400, {1}, {"CPU0"});
+    endTable(0);
+    std::vector<uint8_t> data = table;
+    data.resize(0x100, 0);
+    placeEntryPoint(data, 0x100, entryPoint21(base, table.size()));
+
+    auto entryPoint = findEntryPoint(data.data(), data.size(), base);
+
+    ASSERT_TRUE(entryPoint);
+    EXPECT_EQ(entryPoint->version.majorVersion, 2);
+    EXPECT_EQ(entryPoint->offset, 0x100);
+    EXPECT_EQ(entryPoint->tableOffset, 0);
+    EXPECT_EQ(entryPoint->tableSize, table.size());
+}
+
+TEST_F(SmbiosEntryPointTest, TableSizeIsClampedToData)
+{
+    constexpr uint64_t unmapped = 0x7f000000;
+    addStructure(processorsType, 0x0400, {1}, {"CPU0"});
+    endTable(0);
+    std::vector<uint8_t> data = table;
+    data.resize(0x40, 0);
+    placeEntryPoint(data, 0x40, entryPoint30(unmapped, 0x10000));
+
+    auto entryPoint = findEntryPoint(data.data(), data.size());
+
+    ASSERT_TRUE(entryPoint);
+    EXPECT_EQ(entryPoint->tableOffset, 0);
+    EXPECT_EQ(entryPoint->tableSize, 0x40);
+}
+
+TEST_F(SmbiosEntryPointTest, SkipsBadChecksumAndUnalignedAnchors)
+{
+    std::vector<uint8_t> data(0x80, 0);
+    placeEntryPoint(data, 0x10, entryPoint30(0, 0x10));
+    data[0x10 + offsetof(EntryPointStructure30, structTableMaxSize)] ^= 1;
+    std::memcpy(data.data() + 0x33, "_SM3_", 5);
+
+    EXPECT_FALSE(findEntryPoint(data.data(), data.size()));
+
+    placeEntryPoint(data, 0x60, entryPoint30(0, 0x10));
+    auto entryPoint = findEntryPoint(data.data(), data.size());
+    ASSERT_TRUE(entryPoint);
+    EXPECT_EQ(entryPoint->offset, 0x60);
+}
+
+TEST_F(SmbiosEntryPointTest, PrefersEntryPoint30)
+{
+    std::vector<uint8_t> data(0x100, 0);
+    placeEntryPoint(data, 0x00, entryPoint21(0x80, 0x20));
+    placeEntryPoint(data, 0x20, entryPoint30(0x80, 0x20));
+
+    auto entryPoint = findEntryPoint(data.data(), data.size());
+
+    ASSERT_TRUE(entryPoint);
+    EXPECT_EQ(entryPoint->offset, 0x20);
+    EXPECT_EQ(entryPoint->version.majorVersion, 3);
+}
+
+TEST_F(SmbiosEntryPointTest, TruncatedEntryPointIsIgnored)
+{
+    std::vector<uint8_t> data;
+    placeEntryPoint(data, 0x10, entryPoint30(0, 0x10));
+    data.resize(0x10 + sizeof(EntryPointStructure30) - 1);
+
+    EXPECT_FALSE(findEntryPoint(data.data(), data.size()));
+}
+
+} // namespace smbios
+} // namespace phosphor
@@ -0,0 +1,127 @@
+#include "smbios_fields.hpp"
+#include "smbios_table.hpp"
+#include "smbios_unittest.hpp"
+
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+namespace phosphor
+{
+namespace smbios
+{
+
+static_assert(std::is_same_v<decltype(MemoryDeviceFields::configuredSpeed
+                                          .read(Structure()))::value_type,
+                             uint32_t>);
+static_assert(lengthThrough(MemoryDeviceFields::all, specVersion(2, 7)) ==
+              0x22);
+static_assert(lengthThrough(SystemSlotFields::all, specVersion(2, 1)) ==
+              0x0d);
+
+class SmbiosFieldsTest : public SmbiosTableTest
+{
+  protected:
+    Structure first()
+    {
+        return *Table(table.data(), table.size()).structures().begin();
+    }
+};
+
+TEST_F(SmbiosFieldsTest, ReadsFieldsInsideTheStructure)
+{
+    addStructure(systemSlots, 0x0900,
+                 {1, 0xb6, 0x0d, 0x04, 0x04, 0x34, 0x12, 0x0c, 0x01},
+                 {"PCIE_SLOT1"});
+    endTable();
+    Structure slot = first();
+
+    EXPECT_EQ(SystemSlotFields::handle.read(slot), 0x0900);
+    EXPECT_EQ(SystemSlotFields::slotType.read(slot), 0xb6);
+    EXPECT_EQ(SystemSlotFields::slotId.read(slot), 0x1234);
+    EXPECT_EQ(SystemSlotFields::designation.read(slot), 1);
+    EXPECT_EQ(SystemSlotFields::characteristics2.get(slot), 0x01);
+    EXPECT_FALSE(SystemSlotFields::segmentGroup.read(slot));
+    EXPECT_EQ(SystemSlotFields::segmentGroup.get(slot), 0);
+}
+
+TEST_F(SmbiosFieldsTest, DecodesPresentFieldsWithStrings)
+{
+    addStructure(systemSlots, 0x0900,
+                 {1, 0xb6, 0x0d, 0x04, 0x04, 0x34, 0x12, 0x0c},
+                 {"PCIE_SLOT1"});
+    endTable();
+
+    std::vector<std::string> names;
+    std::string designation;
+    decodeFields(first(), SystemSlotFields::all,
+                 [&](const auto& field, auto value) {
+        names.emplace_back(field.name);
+        if constexpr (std::is_same_v<decltype(value), std::string_view>)
+        {
+            designation = value;
+        }
+    });
+
+    // Slot Characteristics 2 and the 2.6 fields are past the length.
+    EXPECT_EQ(names.size(), 10);
+    EXPECT_EQ(names.front(), "Type");
+    EXPECT_EQ(names.back(), "Slot Characteristics 1");
+    EXPECT_EQ(designation, "PCIE_SLOT1");
+}
+
+TEST_F(SmbiosFieldsTest, MissingStringDecodesEmpty)
+{
+    addStructure(memoryDeviceType, 0x1100,
+                 {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0}, {"DIMM_A1"});
+    endTable();
+
+    std::string_view bank = "unset";
+    decodeFields(first(), MemoryDeviceFields::all,
+                 [&](const auto& field, auto value) {
+        if constexpr (std::is_same_v<decltype(value), std::string_view>)
+        {
+            if (std::string_view(field.name) == "Bank Locator")
+            {
+                bank = value;
+            }
+        }
+    });
+
+    EXPECT_EQ(bank, "");
+}
+
+TEST_F(SmbiosFieldsTest, VisitsEveryDescribedType)
+{
+    for (uint8_t type : {0, 1, 2, 3, 4, 7, 9, 16, 17, 19})
+    {
+        std::string_view first;
+        EXPECT_TRUE(visitTypeFields(type, [&](const auto& fields) {
+            first = std::get<0>(fields).name;
+        }));
+        EXPECT_EQ(first, "Type");
+    }
+    EXPECT_FALSE(visitTypeFields(127, [](const auto&) {}));
+}
+
+TEST_F(SmbiosFieldsTest, ReadsMappedAddressRange)
+{
+    addStructure(memoryArrayMappedAddressType, 0x1300,
+                 {0, 0, 0, 0, 0xff, 0xff, 0x7f, 0, 0x00, 0x10, 2});
+    endTable();
+    Structure range = first();
+
+    EXPECT_EQ(MemoryArrayMappedAddressFields::endingAddress.read(range),
+              0x7fffff);
+    EXPECT_EQ(MemoryArrayMappedAddressFields::arrayHandle.read(range), 0x1000);
+    EXPECT_EQ(MemoryArrayMappedAddressFields::partitionWidth.read(range), 2);
+    EXPECT_FALSE(
+        MemoryArrayMappedAddressFields::extendedStartingAddress.read(range));
+}
+
+} // namespace smbios
+} // namespace phosphor
@@ -0,0 +1,154 @@
+#include "smbios_hash.hpp"
+#include "smbios_unittest.hpp"
+
+#include <unistd.h>
+
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+namespace phosphor
+{
+namespace smbios
+{
+
+static std::string hashOf(const std::string& text)
+{
+    return toHex(
+        sha256(reinterpret_cast<const uint8_t*>(text.data()), text.size()));
+}
+
+TEST(Sha256Test, MatchesKnownDigests)
+{
+    EXPECT_EQ(hashOf(""), "e3b0c44298fc1c149afbf4c8996fb924"
+                          "27ae41e4649b934ca495991b7852b855");
+    EXPECT_EQ(hashOf("abc"), "ba7816bf8f01cfea414140de5dae2223"
+                             "b00361a396177a9cb410ff61f20015ad");
+    // 56 bytes: the length no longer fits in the first padding block.
+    EXPECT_EQ(hashOf("abcdbcdecdefdefgefghfghighijhijk"
+                     "ijkljklmklmnlmnomnopnopq"),
+              "248d6a61d20638b8e5c026930c3e6039"
+              "a33ce45964ff2167f6ecedd419db06c1");
+    EXPECT_EQ(hashOf(std::string(1000, 'a')),
+              "41edece42d63e8d9bf515a9ba6932e1c"
+              "20cbc9f5a5d134645adb5db1b9737ea3");
+}
+
+class TableHashTest : public SmbiosTableTest
+{
+  protected:
+    /* Region data holding a 3.0 entry point at 0 and the table at 0x20. */
+    std::vector<uint8_t> region(uint8_t epRevision)
+    {
+        constexpr size_t tableOffset = 0x20;
+
+        EntryPointStructure30 ep{};
+        std::memcpy(ep.anchorString, "_SM3_", sizeof(ep.anchorString));
+        ep.epLength = sizeof(ep);
+        ep.smbiosVersion = {3, 3};
+        ep.epRevision = epRevision;
+        ep.structTableMaxSize = static_cast<uint32_t>(table.size());
+        ep.structTableAddr = mdr2SMBaseAddress + tableOffset;
+        auto bytes = reinterpret_cast<uint8_t*>(&ep);
+        uint8_t sum = 0;
+        for (size_t index = 0; index < sizeof(ep); index++)
+        {
+            sum += bytes[index];
+        }
+        ep.epChecksum = static_cast<uint8_t>(-sum);
+
+        std::vector<uint8_t> data(tableOffset, 0);
+        std::memcpy(data.data(), &ep, sizeof(ep));
+        data.insert(data.end(), table.begin(), table.end());
+        return data;
+    }
+};
+
+TEST_F(TableHashTest, HashesOnlyTheTable)
+{
+    addStructure(systemType, 0x0100, {1, 2}, {"Intel", "S2600WFT"});
+    endTable();
+
+    std::vector<uint8_t> first = region(1);
+    std::vector<uint8_t> second = region(2);
+    std::optional<TableHash> hash =
+        hashRegionTable(first.data(), first.size());
+    ASSERT_TRUE(hash);
+    EXPECT_EQ(*hash, sha256(table.data(), table.size()));
+    EXPECT_EQ(hashRegionTable(second.data(), second.size()), hash);
+
+    table[5]++;
+    std::vector<uint8_t> changed = region(1);
+    EXPECT_NE(hashRegionTable(changed.data(), changed.size()), hash);
+}
+
+TEST_F(TableHashTest, NeedsAnEntryPoint)
+{
+    addStructure(systemType, 0x0100, {1, 2}, {"Intel", "S2600WFT"});
+    endTable();
+
+    EXPECT_FALSE(hashRegionTable(table.data(), table.size()));
+}
+
+class TableFileTest : public ::testing::Test
+{
+  protected:
+    TableFileTest()
+    {
+        char name[] = "/tmp/smbios_hash_XXXXXX";
+        int fd = mkstemp(name);
+        EXPECT_GE(fd, 0);
+        close(fd);
+        tablePath = name;
+        hashPath = tablePath + ".sha256";
+    }
+
+    ~TableFileTest() override
+    {
+        unlink(tablePath.c_str());
+        unlink(hashPath.c_str());
+    }
+
+    std::string tablePath;
+    std::string hashPath;
+    TableHash hash = sha256(reinterpret_cast<const uint8_t*>("table"), 5);
+};
+
+TEST_F(TableFileTest, StoredHashNamesTheTableInUse)
+{
+    EXPECT_FALSE(tableFileInUse(tablePath.c_str(), hashPath.c_str(), hash));
+
+    ASSERT_TRUE(storeTableHash(hashPath.c_str(), hash));
+    EXPECT_TRUE(tableFileInUse(tablePath.c_str(), hashPath.c_str(), hash));
+    TableHash other = sha256(reinterpret_cast<const uint8_t*>("other"), 5);
+    EXPECT_FALSE(tableFileInUse(tablePath.c_str(), hashPath.c_str(), other));
+}
+
+TEST_F(TableFileTest, RemovedTableIsNotInUse)
+{
+    ASSERT_TRUE(storeTableHash(hashPath.c_str(), hash));
+
+    // The daemon drops a table it cannot use; the same upload must then be
+    // written again rather than taken for the table in use.
+    ASSERT_TRUE(removeTableFile(tablePath.c_str(), hashPath.c_str()));
+    EXPECT_FALSE(tableFileInUse(tablePath.c_str(), hashPath.c_str(), hash));
+    EXPECT_NE(access(hashPath.c_str(), F_OK), 0);
+
+    // Removing what is already gone succeeds.
+    EXPECT_TRUE(removeTableFile(tablePath.c_str(), hashPath.c_str()));
+}
+
+TEST_F(TableFileTest, HashWithoutTableIsNotInUse)
+{
+    ASSERT_TRUE(storeTableHash(hashPath.c_str(), hash));
+    unlink(tablePath.c_str());
+
+    EXPECT_FALSE(tableFileInUse(tablePath.c_str(), hashPath.c_str(), hash));
+}
+
+} // namespace smbios
+} // namespace phosphor
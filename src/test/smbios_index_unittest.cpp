@@ -0,0 +1,155 @@
+#include "smbios_index.hpp"
+#include "smbios_unittest.hpp"
+
+#include <cstdint>
+#include <initializer_list>
+#include <optional>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+namespace phosphor
+{
+namespace smbios
+{
+
+class SmbiosIndexTest : public SmbiosTableTest
+{
+  protected:
+    void build(std::vector<uint8_t>& data)
+    {
+        std::optional<VerifiedTable> verified =
+            VerifiedTable::verify(data.data(), data.size(), {});
+        ASSERT_TRUE(verified);
+        index.build(*verified);
+    }
+
+    SmbiosIndex index;
+};
+
+TEST_F(SmbiosIndexTest, ClearedIndexHasNoStructures)
+{
+    index.clear();
+
+    EXPECT_EQ(index.data(), nullptr);
+    EXPECT_TRUE(index.offsets().empty());
+    EXPECT_EQ(index.get(processorsType, 0), nullptr);
+}
+
+TEST_F(SmbiosIndexTest, RecordsEveryStructureInTableOrder)
+{
+    addStructure(biosType, 0x0000, {1, 2}, {"vendor", "version"});
+    addStructure(processorsType, 0x0400, {1}, {"CPU0"});
+    addStructure(memoryDeviceType, 0x1100, {});
+    addStructure(processorsType, 0x0401, {1}, {"CPU1"});
+    endTable();
+
+    build(table);
+
+    ASSERT_EQ(index.offsets().size(), 5);
+    EXPECT_EQ(index.offsets()[0], 0);
+    EXPECT_EQ(index.count(processorsType), 2);
+    EXPECT_EQ(index.count(memoryDeviceType), 1);
+    EXPECT_EQ(index.count(127), 1);
+    EXPECT_EQ(index.count(systemSlots), 0);
+}
+
+TEST_F(SmbiosIndexTest, GetReturnsNthStructureOfType)
+{
+    addStructure(processorsType, 0x0400, {1}, {"CPU0"});
+    addStructure(memoryDeviceType, 0x1100, {});
+    addStructure(processorsType, 0x0401, {1}, {"CPU1"});
+    endTable();
+
+    build(table);
+
+    uint8_t* cpu1 = index.get(processorsType, 1);
+    ASSERT_NE(cpu1, nullptr);
+    EXPECT_EQ(*cpu1, processorsType);
+    EXPECT_EQ(*(cpu1 + 2), 0x01);
+    EXPECT_EQ(
+        positionToString(1, *(cpu1 + 1), cpu1, table.data() + table.size()),
+        "CPU1");
+    EXPECT_EQ(index.get(processorsType, 2), nullptr);
+}
+
+TEST_F(SmbiosIndexTest, StopsAtDoubleNulPadding)
+{
+    addStructure(memoryDeviceType, 0x1100, {});
+    table.insert(table.end(), 8, 0);
+    addStructure(memoryDeviceType, 0x1101, {});
+
+    build(table);
+
+    EXPECT_EQ(index.count(memoryDeviceType), 1);
+}
+
+TEST_F(SmbiosIndexTest, IndexesTableLargerThan64KiB)
+{
+    constexpr size_t dimms = 1024;
+    for (size_t dimm = 0; dimm < dimms; dimm++)
+    {
+        addStructure(memoryDeviceType, static_cast<uint16_t>(0x1100 + dimm),
+                     std::initializer_list<uint8_t>{1, 2, 3, 4, 5, 6},
+                     {std::string(48, 'D'), "Samsung", "M393A4K40DB3-CWE"});
+    }
+    endTable();
+    ASSERT_GT(table.size(), 64 * 1024);
+
+    build(table);
+
+    EXPECT_EQ(index.count(memoryDeviceType), dimms);
+    EXPECT_EQ(index.count(127), 1);
+    EXPECT_EQ(*(index.get(memoryDeviceType, dimms - 1) + 2),
+              (0x1100 + dimms - 1) & 0xff);
+}
+
+TEST_F(SmbiosIndexTest, GetByHandleResolvesCrossReferences)
+{
+    addStructure(physicalMemoryArrayType, 0x1000, {3, 3, 6});
+    addStructure(memoryDeviceType, 0x1100, {0x00, 0x10}, {"DIMM_A1"});
+    addStructure(physicalMemoryArrayType, 0x1001, {3, 3, 5});
+    addStructure(memoryDeviceType, 0x1101, {0x01, 0x10}, {"DIMM_B1"});
+    endTable();
+
+    build(table);
+
+    uint8_t* dimm = index.get(memoryDeviceType, 1);
+    ASSERT_NE(dimm, nullptr);
+    uint16_t arrayHandle = *(dimm + 4) | (*(dimm + 5) << 8);
+    uint8_t* array = index.getByHandle(arrayHandle);
+    ASSERT_NE(array, nullptr);
+    EXPECT_EQ(array, index.get(physicalMemoryArrayType, 1));
+    EXPECT_EQ(index.getByHandle(0x1101), dimm);
+    EXPECT_EQ(index.getByHandle(0x2000), nullptr);
+}
+
+TEST_F(SmbiosIndexTest, GetByHandleKeepsFirstDuplicate)
+{
+    addStructure(processorsType, 0x0400, {1}, {"CPU0"});
+    addStructure(processorsType, 0x0400, {1}, {"CPU1"});
+    endTable();
+
+    build(table);
+
+    EXPECT_EQ(index.getByHandle(0x0400), index.get(processorsType, 0));
+}
+
+TEST_F(SmbiosIndexTest, RebuildForgetsPreviousTable)
+{
+    addStructure(processorsType, 0x0400, {1}, {"CPU0"});
+    endTable();
+    build(table);
+    ASSERT_EQ(index.count(processorsType), 1);
+
+    std::vector<uint8_t> empty(16, 0);
+    build(empty);
+
+    EXPECT_EQ(index.count(processorsType), 0);
+    EXPECT_TRUE(index.offsets().empty());
+    EXPECT_EQ(index.getByHandle(0x0400), nullptr);
+}
+
+} // namespace smbios
+} // namespace phosphor
@@ -0,0 +1,214 @@
+#include "cpu.hpp"
+#include "dimm.hpp"
+#include "smbios_index.hpp"
+#include "smbios_table.hpp"
+#include "smbios_unittest.hpp"
+
+#include <sdbusplus/test/sdbus_mock.hpp>
+
+#include <cstdint>
+#include <cstring>
+#include <optional>
+#include <string>
+#include <vector>
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+namespace phosphor
+{
+namespace smbios
+{
+
+using DimmItem = sdbusplus::xyz::openbmc_project::Inventory::Item::server::Dimm;
+using Asset =
+    sdbusplus::xyz::openbmc_project::Inventory::Decorator::server::Asset;
+
+class SmbiosInventoryTest : public SmbiosTableTest
+{
+  protected:
+    /* A processor in socket "CPU0"; status bit 6 marks it populated. The
+     * default length is that of SMBIOS 3.0, 0x26 that of 2.5.
+     */
+    void addProcessor(bool populated, uint8_t length = 0x30)
+    {
+        std::vector<uint8_t> formatted(length, 0);
+        formatted[0x00] = processorsType;
+        formatted[0x01] = length;
+        formatted[0x04] = 1;    // socket designation
+        formatted[0x06] = 0xb3; // Intel Xeon processor
+        formatted[0x07] = 2;    // manufacturer
+        formatted[0x08] = 0x57; // id
+        formatted[0x10] = 3;    // version
+        formatted[0x14] = 0xa0; // max speed, 4000 MHz
+        formatted[0x15] = 0x0f;
+        formatted[0x18] = populated ? 0x41 : 0x00;
+        formatted[0x20] = 4;    // serial number
+        formatted[0x22] = 5;    // part number
+        formatted[0x23] = 28;   // core count
+        formatted[0x25] = 56;   // thread count
+        if (length > 0x26)
+        {
+            formatted[0x26] = 0x04; // 64-bit capable
+        }
+        table.insert(table.end(), formatted.begin(), formatted.end());
+        for (const char* str :
+             {"CPU0", "Intel(R) Corporation", "Intel(R) Xeon(R)", "SN0",
+              "PN0"})
+        {
+            table.insert(table.end(), str, str + std::strlen(str) + 1);
+        }
+        table.push_back('\0');
+    }
+
+    void addDimm()
+    {
+        MemoryInfo info{};
+        info.type = memoryDeviceType;
+        info.length = sizeof(MemoryInfo);
+        info.dataWidth = 64;
+        info.size = 0x4000;
+        info.deviceLocator = 1;
+        info.memoryType = 0x1a;
+        info.speed = 3200;
+        info.manufacturer = 2;
+        info.serialNum = 3;
+        info.partNum = 4;
+        auto data = reinterpret_cast<const uint8_t*>(&info);
+        table.insert(table.end(), data, data + sizeof(info));
+        for (const char* str : {"DIMM_A1", "Samsung", "SN1", "M393A4K40DB3"})
+        {
+            table.insert(table.end(), str, str + std::strlen(str) + 1);
+        }
+        table.push_back('\0');
+    }
+
+    /* Index the table built so far, replacing the previous generation. */
+    void build()
+    {
+        endTable();
+        std::optional<VerifiedTable> verified =
+            VerifiedTable::verify(table.data(), table.size(), {});
+        ASSERT_TRUE(verified);
+        index.build(*verified);
+    }
+
+    /* Start the next table generation. */
+    void clearTable()
+    {
+        table.clear();
+    }
+
+    testing::NiceMock<sdbusplus::SdBusMock> sdbusMock;
+    sdbusplus::bus_t bus = sdbusplus::get_mocked_new(&sdbusMock);
+    SmbiosIndex index;
+};
+
+TEST_F(SmbiosInventoryTest, UnpopulatedSocketDropsProcessorDetails)
+{
+    addProcessor(true);
+    build();
+    Cpu<MdrV2Policy> cpu(bus, "/cpu0", 0, index);
+    ASSERT_TRUE(cpu.Item::present());
+    ASSERT_EQ(cpu.processor::family(), "Intel Xeon processor");
+    ASSERT_EQ(cpu.processor::coreCount(), 28);
+
+    clearTable();
+    addProcessor(false);
+    build();
+    cpu.refresh({});
+
+    EXPECT_EQ(cpu.processor::socket(), "CPU0");
+    EXPECT_FALSE(cpu.Item::present());
+    EXPECT_EQ(cpu.processor::family(), "");
+    EXPECT_EQ(cpu.processor::effectiveFamily(), 0);
+    EXPECT_EQ(cpu.asset::manufacturer(), "");
+    EXPECT_EQ(cpu.processor::id(), 0);
+    EXPECT_EQ(cpu.rev::version(), "");
+    EXPECT_EQ(cpu.processor::maxSpeedInMhz(), 0);
+    EXPECT_EQ(cpu.asset::serialNumber(), "");
+    EXPECT_EQ(cpu.asset::partNumber(), "");
+    EXPECT_EQ(cpu.processor::coreCount(), 0);
+    EXPECT_EQ(cpu.processor::threadCount(), 0);
+    EXPECT_TRUE(cpu.processor::characteristics().empty());
+}
+
+TEST_F(SmbiosInventoryTest, MissingProcessorClearsObject)
+{
+    addProcessor(true);
+    build();
+    Cpu<MdrV2Policy> cpu(bus, "/cpu0", 0, index);
+
+    clearTable();
+    build();
+    cpu.refresh({});
+
+    EXPECT_EQ(cpu.processor::socket(), "");
+    EXPECT_FALSE(cpu.Item::present());
+    EXPECT_EQ(cpu.processor::family(), "");
+    EXPECT_EQ(cpu.asset::manufacturer(), "");
+    EXPECT_EQ(cpu.processor::coreCount(), 0);
+}
+
+TEST_F(SmbiosInventoryTest, V1AcceptsProcessorBefore30)
+{
+    addProcessor(true, 0x26);
+    endTable();
+    EXPECT_FALSE(VerifiedTable::verify(table.data(), table.size(),
+                                       MdrV2Policy::requiredLengths));
+    std::optional<VerifiedTable> verified = VerifiedTable::verify(
+        table.data(), table.size(), MdrV1Policy::requiredLengths);
+    ASSERT_TRUE(verified);
+    index.build(*verified);
+
+    Cpu<MdrV1Policy> cpu(bus, "/cpu0", 0, index);
+    EXPECT_TRUE(cpu.Item::present());
+    EXPECT_EQ(cpu.processor::family(), "Intel Xeon processor");
+    EXPECT_EQ(cpu.processor::coreCount(), 28);
+    EXPECT_EQ(cpu.processor::threadCount(), 56);
+}
+
+TEST_F(SmbiosInventoryTest, MissingMemoryDeviceClearsObject)
+{
+    addDimm();
+    build();
+    Dimm<MdrV2Policy> dimm(bus, "/dimm0", 0, index);
+    ASSERT_TRUE(dimm.Item::present());
+    ASSERT_EQ(dimm.DimmItem::memorySizeInKB(), 0x4000 * 1024);
+
+    clearTable();
+    build();
+    dimm.refresh({});
+
+    EXPECT_FALSE(dimm.Item::present());
+    EXPECT_EQ(dimm.DimmItem::memorySizeInKB(), 0);
+    EXPECT_EQ(dimm.DimmItem::memoryDataWidth(), 0);
+    EXPECT_EQ(dimm.DimmItem::memoryDeviceLocator(), "");
+    EXPECT_EQ(dimm.DimmItem::maxMemorySpeedInMhz(), 0);
+    EXPECT_EQ(dimm.Asset::manufacturer(), "");
+    EXPECT_EQ(dimm.Asset::serialNumber(), "");
+    EXPECT_EQ(dimm.Asset::partNumber(), "");
+}
+
+TEST_F(SmbiosInventoryTest, UnknownMotherboardDropsAssociations)
+{
+    addProcessor(true);
+    addDimm();
+    build();
+    const std::string motherboard =
+        "/xyz/openbmc_project/inventory/system/board/motherboard";
+    Cpu<MdrV2Policy> cpu(bus, "/cpu0", 0, index, motherboard);
+    Dimm<MdrV2Policy> dimm(bus, "/dimm0", 0, index, motherboard);
+    ASSERT_EQ(cpu.association::associations().size(), 1);
+    ASSERT_EQ(dimm.association::associations().size(), 1);
+
+    // The mapper lookup failed on this sync; the table is unchanged.
+    cpu.refresh({});
+    dimm.refresh({});
+
+    EXPECT_TRUE(cpu.association::associations().empty());
+    EXPECT_TRUE(dimm.association::associations().empty());
+}
+
+} // namespace smbios
+} // namespace phosphor
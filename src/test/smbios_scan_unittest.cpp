@@ -0,0 +1,100 @@
+#include "smbios_scan.hpp"
+
+#include <cstdint>
+#include <random>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+namespace phosphor
+{
+namespace smbios
+{
+
+namespace
+{
+
+/* The byte loop smbiosNextPtr used before the scanner. */
+size_t referenceStringSetEnd(const uint8_t* data, size_t count)
+{
+    for (size_t offset = 0; offset < count; offset++)
+    {
+        if ((data[offset] | data[offset + 1]) == 0)
+        {
+            return offset;
+        }
+    }
+    return count;
+}
+
+} // namespace
+
+class SmbiosScanTest : public ::testing::Test
+{
+  protected:
+    SmbiosScanTest() : buffer(512, 'a')
+    {}
+
+    std::vector<uint8_t> buffer;
+};
+
+TEST_F(SmbiosScanTest, FindsTerminatorAtStart)
+{
+    buffer[0] = 0;
+    buffer[1] = 0;
+
+    EXPECT_EQ(findStringSetEnd(buffer.data(), 100), 0);
+}
+
+TEST_F(SmbiosScanTest, SkipsSingleNulBetweenStrings)
+{
+    buffer[5] = 0;
+    buffer[40] = 0;
+    buffer[41] = 0;
+
+    EXPECT_EQ(findStringSetEnd(buffer.data(), 100), 40);
+}
+
+TEST_F(SmbiosScanTest, TerminatorOutsideRangeIsNotFound)
+{
+    buffer[100] = 0;
+    buffer[101] = 0;
+
+    EXPECT_EQ(findStringSetEnd(buffer.data(), 100), 100);
+    EXPECT_EQ(findStringSetEnd(buffer.data(), 101), 100);
+}
+
+TEST_F(SmbiosScanTest, SecondNulMayBeLastByteInRange)
+{
+    // The check at the last candidate offset reads one byte past it.
+    buffer[99] = 0;
+    buffer[100] = 0;
+
+    EXPECT_EQ(findStringSetEnd(buffer.data(), 100), 99);
+}
+
+TEST_F(SmbiosScanTest, MatchesByteLoopAtEveryAlignment)
+{
+    std::mt19937 gen(17);
+    std::uniform_int_distribution<int> byte(0, 7);
+    for (uint8_t& value : buffer)
+    {
+        // Mostly printable, with frequent NULs and occasional pairs.
+        value = byte(gen) == 0 ? 0 : 'x';
+    }
+    buffer.back() = 0;
+    *(buffer.end() - 2) = 0;
+
+    for (size_t start = 0; start < 64; start++)
+    {
+        for (size_t count = 0; start + count + 1 < buffer.size(); count += 7)
+        {
+            EXPECT_EQ(findStringSetEnd(buffer.data() + start, count),
+                      referenceStringSetEnd(buffer.data() + start, count))
+                << "start " << start << " count " << count;
+        }
+    }
+}
+
+} // namespace smbios
+} // namespace phosphor
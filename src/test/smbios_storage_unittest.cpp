@@ -0,0 +1,167 @@
+#include "smbios_storage.hpp"
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <optional>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+namespace phosphor
+{
+namespace smbios
+{
+
+class TableFileTest : public ::testing::Test
+{
+  protected:
+    TableFileTest()
+    {
+        char name[] = "/tmp/smbios_storage_XXXXXX";
+        int fd = mkstemp(name);
+        EXPECT_GE(fd, 0);
+        close(fd);
+        path = name;
+    }
+
+    ~TableFileTest() override
+    {
+        unlink(path.c_str());
+    }
+
+    /* Write a header claiming dataSize bytes, followed by data. */
+    void writeFile(uint32_t dataSize, const std::vector<uint8_t>& data,
+                   const std::string& to)
+    {
+        MDRSMBIOSHeader header{};
+        header.mdrType = mdrTypeII;
+        header.dataSize = dataSize;
+        std::ofstream file(to, std::ios_base::binary | std::ios_base::trunc);
+        file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+        file.write(reinterpret_cast<const char*>(data.data()), data.size());
+    }
+
+    std::string path;
+    LoadError error{};
+};
+
+TEST_F(TableFileTest, MapsRegionData)
+{
+    writeFile(4, {1, 2, 3, 4}, path);
+
+    std::optional<TableFile> file = TableFile::load(path.c_str(), 16, &error);
+    ASSERT_TRUE(file);
+    EXPECT_EQ(file->header().dataSize, 4);
+    ASSERT_EQ(file->data().size(), 4);
+    EXPECT_EQ(std::memcmp(file->data().data(), "\1\2\3\4", 4), 0);
+    EXPECT_EQ(file->status().st_size, sizeof(MDRSMBIOSHeader) + 4);
+}
+
+TEST_F(TableFileTest, ClampsDataToFileSize)
+{
+    writeFile(8, {1, 2, 3}, path);
+
+    std::optional<TableFile> file = TableFile::load(path.c_str(), 16);
+    ASSERT_TRUE(file);
+    EXPECT_EQ(file->data().size(), 3);
+}
+
+TEST_F(TableFileTest, RejectsBadFiles)
+{
+    EXPECT_FALSE(TableFile::load("/nonexistent/smbios2", 16, &error));
+    EXPECT_EQ(error, LoadError::open);
+
+    // The temporary file starts out empty.
+    EXPECT_FALSE(TableFile::load(path.c_str(), 16, &error));
+    EXPECT_EQ(error, LoadError::tooSmall);
+
+    writeFile(32, std::vector<uint8_t>(32), path);
+    EXPECT_FALSE(TableFile::load(path.c_str(), 16, &error));
+    EXPECT_EQ(error, LoadError::tooLarge);
+}
+
+TEST_F(TableFileTest, MappingSurvivesReplacement)
+{
+    writeFile(4, {1, 2, 3, 4}, path);
+    std::optional<TableFile> file = TableFile::load(path.c_str(), 16);
+    ASSERT_TRUE(file);
+
+    std::string replacement = path + ".tmp";
+    writeFile(2, {9, 9}, replacement);
+    ASSERT_EQ(std::rename(replacement.c_str(), path.c_str()), 0);
+
+    TableFile moved = std::move(*file);
+    EXPECT_FALSE(file->mapped());
+    ASSERT_EQ(moved.data().size(), 4);
+    EXPECT_EQ(moved.data()[3], 4);
+}
+
+TEST_F(TableFileTest, CopySurvivesRewriteInPlace)
+{
+    writeFile(4, {1, 2, 3, 4}, path);
+    std::optional<TableFile> file = TableFile::load(path.c_str(), 16);
+    ASSERT_TRUE(file);
+
+    // Truncating a mapped file would fault on the next read.
+    ASSERT_EQ(truncate(path.c_str(), 0), 0);
+    EXPECT_EQ(file->header().dataSize, 4);
+    ASSERT_EQ(file->data().size(), 4);
+    EXPECT_EQ(file->data()[3], 4);
+
+    writeFile(2, {9, 9}, path);
+    EXPECT_EQ(file->data()[0], 1);
+}
+
+TEST(SealedTableTest, HoldsGenerationAndTable)
+{
+    const std::vector<uint8_t> table = {1, 2, 3, 4, 5};
+    std::optional<SealedTable> sealed =
+        SealedTable::create(7, table.data(), table.size());
+    ASSERT_TRUE(sealed);
+    ASSERT_GE(sealed->fd(), 0);
+
+    struct stat status;
+    ASSERT_EQ(fstat(sealed->fd(), &status), 0);
+    ASSERT_EQ(status.st_size, sizeof(RawTableHeader) + table.size());
+
+    void* address = mmap(nullptr, status.st_size, PROT_READ, MAP_SHARED,
+                         sealed->fd(), 0);
+    ASSERT_NE(address, MAP_FAILED);
+    RawTableHeader header;
+    std::memcpy(&header, address, sizeof(header));
+    EXPECT_EQ(header.generation, 7);
+    EXPECT_EQ(header.tableOffset, sizeof(header));
+    EXPECT_EQ(header.tableSize, table.size());
+    EXPECT_EQ(std::memcmp(static_cast<uint8_t*>(address) + header.tableOffset,
+                          table.data(), table.size()),
+              0);
+    munmap(address, status.st_size);
+}
+
+TEST(SealedTableTest, CannotBeChanged)
+{
+    const std::vector<uint8_t> table = {1, 2, 3, 4};
+    std::optional<SealedTable> sealed =
+        SealedTable::create(1, table.data(), table.size());
+    ASSERT_TRUE(sealed);
+
+    EXPECT_EQ(fcntl(sealed->fd(), F_GET_SEALS),
+              F_SEAL_SHRINK | F_SEAL_GROW | F_SEAL_WRITE | F_SEAL_SEAL);
+    uint8_t byte = 0;
+    EXPECT_EQ(pwrite(sealed->fd(), &byte, 1, 0), -1);
+    EXPECT_NE(ftruncate(sealed->fd(), 0), 0);
+    EXPECT_EQ(mmap(nullptr, 1, PROT_WRITE, MAP_SHARED, sealed->fd(), 0),
+              MAP_FAILED);
+}
+
+} // namespace smbios
+} // namespace phosphor
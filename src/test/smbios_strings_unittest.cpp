@@ -0,0 +1,99 @@
+#include "smbios_parse.hpp"
+#include "smbios_unittest.hpp"
+
+#include <cstdint>
+#include <string_view>
+
+#include <gtest/gtest.h>
+
+namespace phosphor
+{
+namespace smbios
+{
+
+class SmbiosStringsTest : public SmbiosTableTest
+{};
+
+TEST_F(SmbiosStringsTest, LooksUpEveryPosition)
+{
+    addStructure(memoryDeviceType, 0x1100, {1, 2, 3},
+                 {"DIMM_A1", "NODE 0", "Samsung"});
+    endTable();
+
+    SmbiosStrings strings(table.data());
+
+    ASSERT_EQ(strings.size(), 3);
+    EXPECT_EQ(strings[1], "DIMM_A1");
+    EXPECT_EQ(strings[2], "NODE 0");
+    EXPECT_EQ(strings[3], "Samsung");
+}
+
+TEST_F(SmbiosStringsTest, ZeroAndOutOfRangePositionsAreEmpty)
+{
+    addStructure(processorsType, 0x0400, {1}, {"CPU0"});
+    endTable();
+
+    SmbiosStrings strings(table.data());
+
+    EXPECT_TRUE(strings[0].empty());
+    EXPECT_TRUE(strings[2].empty());
+    EXPECT_TRUE(strings[255].empty());
+}
+
+TEST_F(SmbiosStringsTest, StructureWithoutStringsHasEmptySet)
+{
+    addStructure(memoryDeviceType, 0x1100, {0, 0});
+    addStructure(processorsType, 0x0400, {1}, {"CPU0"});
+    endTable();
+
+    SmbiosStrings strings(table.data());
+
+    EXPECT_EQ(strings.size(), 0);
+    EXPECT_TRUE(strings[1].empty());
+}
+
+TEST_F(SmbiosStringsTest, ViewsPointIntoTableStorage)
+{
+    addStructure(systemType, 0x0100, {1}, {"Manufacturer"});
+    endTable();
+
+    SmbiosStrings strings(table.data());
+    std::string_view value = strings[1];
+
+    EXPECT_EQ(reinterpret_cast<const uint8_t*>(value.data()),
+              table.data() + 5);
+}
+
+TEST_F(SmbiosStringsTest, MatchesPositionToString)
+{
+    addStructure(memoryDeviceType, 0x1100, {1, 2, 3, 4},
+                 {"DIMM_A1", "NODE 0", "Samsung", "M393A4K40DB3  "});
+    endTable();
+
+    SmbiosStrings strings(table.data());
+    uint8_t length = table[1];
+
+    for (uint8_t position = 1; position <= 4; position++)
+    {
+        EXPECT_EQ(strings[position],
+                  positionToString(position, length, table.data(),
+                                   table.data() + table.size()));
+    }
+}
+
+TEST_F(SmbiosStringsTest, PositionToStringStopsAtTableEnd)
+{
+    addStructure(systemType, 0x0100, {1, 2}, {"Manufacturer", "Product"});
+    // Cut the table inside the second string: no terminator before end.
+    table.erase(table.end() - 4, table.end());
+
+    EXPECT_EQ(positionToString(1, table[1], table.data(),
+                               table.data() + table.size()),
+              "");
+    EXPECT_EQ(positionToString(2, table[1], table.data(),
+                               table.data() + table.size()),
+              "");
+}
+
+} // namespace smbios
+} // namespace phosphor
@@ -0,0 +1,186 @@
+#include "smbios_table.hpp"
+#include "smbios_unittest.hpp"
+
+#include <cstdint>
+#include <iterator>
+#include <optional>
+#include <ranges>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+namespace phosphor
+{
+namespace smbios
+{
+
+static_assert(std::forward_iterator<Table::iterator>);
+static_assert(std::ranges::forward_range<decltype(Table().structures())>);
+
+class SmbiosTableRangeTest : public SmbiosTableTest
+{};
+
+TEST_F(SmbiosTableRangeTest, EmptyTableHasNoStructures)
+{
+    EXPECT_TRUE(Table().structures().empty());
+
+    std::vector<uint8_t> empty(16, 0);
+    EXPECT_TRUE(Table(empty.data(), empty.size()).structures().empty());
+}
+
+TEST_F(SmbiosTableRangeTest, VisitsStructuresInTableOrder)
+{
+    addStructure(biosType, 0x0000, {1, 2}, {"vendor", "version"});
+    addStructure(processorsType, 0x0400, {1}, {"CPU0"});
+    addStructure(memoryDeviceType, 0x1100, {});
+    endTable();
+
+    std::vector<uint16_t> handles;
+    for (Structure structure : Table(table.data(), table.size()).structures())
+    {
+        handles.push_back(structure.handle());
+    }
+
+    EXPECT_EQ(handles, (std::vector<uint16_t>{0x0000, 0x0400, 0x1100, 0xfeff}));
+}
+
+TEST_F(SmbiosTableRangeTest, FiltersByType)
+{
+    addStructure(processorsType, 0x0400, {1}, {"CPU0"});
+    addStructure(memoryDeviceType, 0x1100, {});
+    addStructure(processorsType, 0x0401, {1}, {"CPU1"});
+    endTable();
+    Table smbiosTable(table.data(), table.size());
+
+    auto cpus =
+        smbiosTable.structures() | std::views::filter(byType(processorsType));
+
+    EXPECT_EQ(std::ranges::distance(cpus), 2);
+    auto cpu = std::ranges::next(cpus.begin());
+    EXPECT_EQ((*cpu).handle(), 0x0401);
+    EXPECT_EQ((*cpu).strings()[1], "CPU1");
+}
+
+TEST_F(SmbiosTableRangeTest, StopsBeforeTruncatedStructure)
+{
+    addStructure(processorsType, 0x0400, {1}, {"CPU0"});
+    addStructure(processorsType, 0x0401, {1}, {"CPU1"});
+    table.resize(table.size() - 3);
+
+    EXPECT_EQ(
+        std::ranges::distance(Table(table.data(), table.size()).structures()),
+        1);
+}
+
+TEST_F(SmbiosTableRangeTest, TypedViewChecksLength)
+{
+    struct Info
+    {
+        uint8_t type;
+        uint8_t length;
+        uint16_t handle;
+        uint8_t value;
+    } __attribute__((packed));
+
+    addStructure(processorsType, 0x0400, {7});
+    addStructure(processorsType, 0x0401, {});
+    endTable();
+    Table smbiosTable(table.data(), table.size());
+    auto it = smbiosTable.structures().begin();
+
+    ASSERT_NE((*it).as<Info>(), nullptr);
+    EXPECT_EQ((*it).as<Info>()->value, 7);
+    EXPECT_EQ((*++it).as<Info>(), nullptr);
+}
+
+TEST_F(SmbiosTableRangeTest, VerifyAcceptsWellFormedTable)
+{
+    addStructure(processorsType, 0x0400, {1}, {"CPU0"});
+    addStructure(memoryDeviceType, 0x1100, {});
+    endTable();
+
+    auto verified = VerifiedTable::verify(table.data(), table.size(), {});
+
+    ASSERT_TRUE(verified);
+    EXPECT_EQ(verified->data(), table.data());
+    // The padding after the end-of-table structure is not part of it.
+    EXPECT_EQ(verified->size(), table.size() - 16);
+    EXPECT_EQ(std::ranges::distance(verified->table().structures()), 3);
+}
+
+TEST_F(SmbiosTableRangeTest, VerifyStopsAtEndOfTable)
+{
+    addStructure(processorsType, 0x0400, {1}, {"CPU0"});
+    endTable(0);
+    size_t tableSize = table.size();
+    addStructure(processorsType, 0x0401, {1}, {"CPU1"});
+
+    auto verified = VerifiedTable::verify(table.data(), table.size(), {});
+
+    ASSERT_TRUE(verified);
+    EXPECT_EQ(verified->size(), tableSize);
+}
+
+TEST_F(SmbiosTableRangeTest, VerifyRejectsStructureRunningPastEnd)
+{
+    addStructure(processorsType, 0x0400, {1}, {"CPU0"});
+    addStructure(processorsType, 0x0401, {1}, {"CPU1"});
+    table.resize(table.size() - 3);
+
+    EXPECT_FALSE(VerifiedTable::verify(table.data(), table.size(), {}));
+}
+
+TEST_F(SmbiosTableRangeTest, VerifyRejectsLengthShorterThanHeader)
+{
+    addStructure(processorsType, 0x0400, {1}, {"CPU0"});
+    table.push_back(memoryDeviceType);
+    table.push_back(2);
+    table.insert(table.end(), {0x00, 0x11, 0x00, 0x00});
+
+    EXPECT_FALSE(VerifiedTable::verify(table.data(), table.size(), {}));
+}
+
+TEST_F(SmbiosTableRangeTest, VerifyRejectsShortRequiredType)
+{
+    LengthRequirements required{};
+    required[memoryDeviceType] = 0x08;
+    addStructure(memoryDeviceType, 0x1100, {0, 0, 0, 0});
+    addStructure(memoryDeviceType, 0x1101, {0, 0, 0});
+    endTable();
+
+    EXPECT_FALSE(VerifiedTable::verify(table.data(), table.size(), required));
+
+    table.clear();
+    addStructure(memoryDeviceType, 0x1100, {0, 0, 0, 0});
+    endTable();
+    EXPECT_TRUE(VerifiedTable::verify(table.data(), table.size(), required));
+}
+
+TEST_F(SmbiosTableRangeTest, VerifyReportsRejectedStructure)
+{
+    LengthRequirements required{};
+    required[memoryDeviceType] = 0x08;
+    addStructure(processorsType, 0x0400, {1}, {"CPU0"});
+    size_t offset = table.size();
+    addStructure(memoryDeviceType, 0x1100, {0, 0, 0});
+    endTable();
+
+    VerifyError error{};
+    EXPECT_FALSE(
+        VerifiedTable::verify(table.data(), table.size(), required, &error));
+    EXPECT_EQ(error.reason, VerifyError::Reason::tooShort);
+    EXPECT_EQ(error.offset, offset);
+    EXPECT_EQ(error.type, memoryDeviceType);
+    EXPECT_EQ(error.length, 0x07);
+
+    table.clear();
+    addStructure(processorsType, 0x0400, {1}, {"CPU0"});
+    addStructure(processorsType, 0x0401, {1}, {"CPU1"});
+    table.resize(table.size() - 3);
+    EXPECT_FALSE(VerifiedTable::verify(table.data(), table.size(), {}, &error));
+    EXPECT_EQ(error.reason, VerifyError::Reason::malformed);
+    EXPECT_EQ(error.offset, offset);
+}
+
+} // namespace smbios
+} // namespace phosphor
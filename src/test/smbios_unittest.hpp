@@ -0,0 +1,59 @@
+#pragma once
+
+#include "smbios_parse.hpp"
+
+#include <cstdint>
+#include <initializer_list>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+namespace phosphor
+{
+namespace smbios
+{
+
+class SmbiosTableTest : public ::testing::Test
+{
+  protected:
+    SmbiosTableTest() = default;
+
+    /* Append one structure: the header, the rest of the formatted area and
+     * the string set. A structure without strings ends in two NULs.
+     */
+    void addStructure(uint8_t type, uint16_t handle,
+                      std::initializer_list<uint8_t> formatted,
+                      std::initializer_list<std::string> strings = {})
+    {
+        table.push_back(type);
+        table.push_back(static_cast<uint8_t>(4 + formatted.size()));
+        table.push_back(handle & 0xff);
+        table.push_back(handle >> 8);
+        table.insert(table.end(), formatted);
+        for (const std::string& str : strings)
+        {
+            table.insert(table.end(), str.begin(), str.end());
+            table.push_back('\0');
+        }
+        if (strings.size() == 0)
+        {
+            table.push_back('\0');
+        }
+        table.push_back('\0');
+    }
+
+    /* Terminate the table the way the host does: an end-of-table structure
+     * followed by zero padding.
+     */
+    void endTable(size_t padding = 16)
+    {
+        addStructure(127, 0xfeff, {});
+        table.insert(table.end(), padding, 0);
+    }
+
+    std::vector<uint8_t> table;
+};
+
+} // namespace smbios
+} // namespace phosphor